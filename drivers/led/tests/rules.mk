@@ -0,0 +1,30 @@
+ws2812_spi_encoder_common_SRC := \
+	$(DRIVER_PATH)/led/tests/ws2812_spi_encoder.cpp
+ws2812_spi_encoder_common_INC := \
+	$(DRIVER_PATH)/led
+
+ws2812_spi_encoder_grb_DEFS := -DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_GRB
+ws2812_spi_encoder_grb_SRC  := $(ws2812_spi_encoder_common_SRC)
+ws2812_spi_encoder_grb_INC  := $(ws2812_spi_encoder_common_INC)
+
+ws2812_spi_encoder_rgb_DEFS := -DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_RGB
+ws2812_spi_encoder_rgb_SRC  := $(ws2812_spi_encoder_common_SRC)
+ws2812_spi_encoder_rgb_INC  := $(ws2812_spi_encoder_common_INC)
+
+ws2812_spi_encoder_bgr_DEFS := -DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_BGR
+ws2812_spi_encoder_bgr_SRC  := $(ws2812_spi_encoder_common_SRC)
+ws2812_spi_encoder_bgr_INC  := $(ws2812_spi_encoder_common_INC)
+
+ws2812_spi_encoder_rgbw_DEFS := -DWS2812_RGBW
+ws2812_spi_encoder_rgbw_SRC  := $(ws2812_spi_encoder_common_SRC)
+ws2812_spi_encoder_rgbw_INC  := $(ws2812_spi_encoder_common_INC)
+
+snled27351_mono_DEFS := \
+	-DSNLED27351_I2C_ADDRESS_1=SNLED27351_I2C_ADDRESS_GND \
+	-DSNLED27351_I2C_ADDRESS_2=SNLED27351_I2C_ADDRESS_SCL \
+	-DSNLED27351_LED_COUNT=64
+snled27351_mono_SRC := \
+	$(DRIVER_PATH)/led/tests/snled27351_mono.cpp \
+	$(DRIVER_PATH)/led/snled27351-mono.c
+snled27351_mono_INC := \
+	$(DRIVER_PATH)/led
@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "snled27351-mono.h"
+#include "i2c_master.h"
+}
+
+// A model of the chips on the bus, following page selects and auto-increment writes
+static uint8_t chip_page[SNLED27351_DRIVER_COUNT];
+static uint8_t chip_registers[SNLED27351_DRIVER_COUNT][5][256];
+static int     chip_pwm_transfers[SNLED27351_DRIVER_COUNT];
+
+extern "C" {
+// Every other register of both chips, in a scattered order
+const snled27351_led_t PROGMEM g_snled27351_leds[SNLED27351_LED_COUNT] = {
+#define LED(n) {(n) % SNLED27351_DRIVER_COUNT, (uint8_t)(((n) * 37) % 96 * 2)}
+#define LED8(n) LED(n), LED(n + 1), LED(n + 2), LED(n + 3), LED(n + 4), LED(n + 5), LED(n + 6), LED(n + 7)
+    LED8(0), LED8(8), LED8(16), LED8(24), LED8(32), LED8(40), LED8(48), LED8(56),
+};
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    uint8_t chip = (devaddr >> 1) - SNLED27351_I2C_ADDRESS_GND;
+    if (regaddr == SNLED27351_REG_COMMAND) {
+        chip_page[chip] = data[0];
+        return I2C_STATUS_SUCCESS;
+    }
+    if (chip_page[chip] == SNLED27351_COMMAND_PWM) {
+        chip_pwm_transfers[chip]++;
+    }
+    for (uint16_t i = 0; i < length && regaddr + i < 256; i++) {
+        chip_registers[chip][chip_page[chip]][regaddr + i] = data[i];
+    }
+    return I2C_STATUS_SUCCESS;
+}
+}
+
+class Snled27351Mono : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        snled27351_init_drivers();
+        memset(chip_pwm_transfers, 0, sizeof(chip_pwm_transfers));
+    }
+};
+
+TEST_F(Snled27351Mono, RegisterImageMatchesPerLedWrites) {
+    uint8_t expected[SNLED27351_DRIVER_COUNT][SNLED27351_LED_PWM_LENGTH] = {};
+    for (int i = 0; i < SNLED27351_LED_COUNT; i++) {
+        uint8_t value = i * 7 + 3;
+        snled27351_set_value(i, value);
+        expected[g_snled27351_leds[i].driver][g_snled27351_leds[i].v] = value;
+    }
+    snled27351_flush();
+
+    for (int chip = 0; chip < SNLED27351_DRIVER_COUNT; chip++) {
+        EXPECT_EQ(memcmp(chip_registers[chip][SNLED27351_COMMAND_PWM], expected[chip], SNLED27351_LED_PWM_LENGTH), 0) << "chip " << chip;
+    }
+}
+
+TEST_F(Snled27351Mono, FlushesEachChipInOneTransfer) {
+    snled27351_set_value_all(0x55);
+    snled27351_flush();
+    for (int chip = 0; chip < SNLED27351_DRIVER_COUNT; chip++) {
+        EXPECT_EQ(chip_pwm_transfers[chip], 1);
+    }
+
+    // nothing changed, so nothing is sent
+    snled27351_set_value(0, 0x55);
+    snled27351_flush();
+    for (int chip = 0; chip < SNLED27351_DRIVER_COUNT; chip++) {
+        EXPECT_EQ(chip_pwm_transfers[chip], 1);
+    }
+}
@@ -0,0 +1,6 @@
+TEST_LIST += \
+	ws2812_spi_encoder_grb \
+	ws2812_spi_encoder_rgb \
+	ws2812_spi_encoder_bgr \
+	ws2812_spi_encoder_rgbw \
+	snled27351_mono
@@ -0,0 +1,82 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ws2812_spi_encoder.h"
+}
+
+class WS2812SpiEncoder : public ::testing::Test {};
+
+// The original bit-at-a-time encoder, used as the reference
+static uint8_t get_protocol_eq(uint8_t data, int pos) {
+    uint8_t eq = 0;
+    if (data & (1 << (2 * (3 - pos))))
+        eq = 0b1110;
+    else
+        eq = 0b1000;
+    if (data & (2 << (2 * (3 - pos))))
+        eq += 0b11100000;
+    else
+        eq += 0b10000000;
+    return eq;
+}
+
+static void reference_encode_byte(uint8_t *out, uint8_t data) {
+    for (int j = 0; j < 4; j++) {
+        out[j] = get_protocol_eq(data, j);
+    }
+}
+
+static void reference_encode_led(uint8_t *out, const ws2812_led_t &led) {
+#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
+    reference_encode_byte(&out[0], led.g);
+    reference_encode_byte(&out[4], led.r);
+    reference_encode_byte(&out[8], led.b);
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
+    reference_encode_byte(&out[0], led.r);
+    reference_encode_byte(&out[4], led.g);
+    reference_encode_byte(&out[8], led.b);
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
+    reference_encode_byte(&out[0], led.b);
+    reference_encode_byte(&out[4], led.g);
+    reference_encode_byte(&out[8], led.r);
+#endif
+#ifdef WS2812_RGBW
+    reference_encode_byte(&out[12], led.w);
+#endif
+}
+
+TEST_F(WS2812SpiEncoder, EncodesEveryByteValue) {
+    for (int data = 0; data < 256; data++) {
+        uint8_t  expected[4];
+        uint32_t actual = ws2812_spi_encode_byte(data);
+
+        reference_encode_byte(expected, data);
+        EXPECT_EQ(memcmp(expected, &actual, sizeof(expected)), 0) << "data = " << data;
+    }
+}
+
+TEST_F(WS2812SpiEncoder, EncodesLedsInWireOrder) {
+    uint32_t seed = 0x12345678;
+    for (int i = 0; i < 1000; i++) {
+        ws2812_led_t led;
+        seed  = seed * 1103515245 + 12345;
+        led.r = seed >> 8;
+        led.g = seed >> 16;
+        led.b = seed >> 24;
+#ifdef WS2812_RGBW
+        led.w = seed;
+#endif
+
+        uint8_t  expected[4 * sizeof(ws2812_led_t)];
+        uint32_t actual[sizeof(ws2812_led_t)];
+
+        reference_encode_led(expected, led);
+        ws2812_spi_encode_led(actual, &led);
+        EXPECT_EQ(memcmp(expected, actual, sizeof(expected)), 0) << "iteration " << i;
+    }
+}
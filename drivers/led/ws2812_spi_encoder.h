@@ -0,0 +1,50 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "ws2812.h"
+
+/*
+ * The SPI WS2812 driver sends each colour bit as a 4 bit SPI symbol,
+ * 0b1110 for a 1 and 0b1000 for a 0, so every colour byte expands to
+ * four SPI bytes with the most significant bit pair sent first.
+ *
+ * Two colour bits map to one SPI byte, so a nibble maps to two SPI
+ * bytes. These are stored little-endian, so that combining two table
+ * entries yields a 32 bit word which can be stored in one go.
+ */
+#define WS2812_SPI_SYMBOL_PAIR(bits) ((((bits) & 2) ? 0xE0 : 0x80) | (((bits) & 1) ? 0x0E : 0x08))
+#define WS2812_SPI_SYMBOL_NIBBLE(nibble) (WS2812_SPI_SYMBOL_PAIR((nibble) >> 2) | (WS2812_SPI_SYMBOL_PAIR((nibble) & 3) << 8))
+
+// clang-format off
+static const uint16_t ws2812_spi_nibble_lut[16] = {
+    WS2812_SPI_SYMBOL_NIBBLE(0x0), WS2812_SPI_SYMBOL_NIBBLE(0x1), WS2812_SPI_SYMBOL_NIBBLE(0x2), WS2812_SPI_SYMBOL_NIBBLE(0x3),
+    WS2812_SPI_SYMBOL_NIBBLE(0x4), WS2812_SPI_SYMBOL_NIBBLE(0x5), WS2812_SPI_SYMBOL_NIBBLE(0x6), WS2812_SPI_SYMBOL_NIBBLE(0x7),
+    WS2812_SPI_SYMBOL_NIBBLE(0x8), WS2812_SPI_SYMBOL_NIBBLE(0x9), WS2812_SPI_SYMBOL_NIBBLE(0xA), WS2812_SPI_SYMBOL_NIBBLE(0xB),
+    WS2812_SPI_SYMBOL_NIBBLE(0xC), WS2812_SPI_SYMBOL_NIBBLE(0xD), WS2812_SPI_SYMBOL_NIBBLE(0xE), WS2812_SPI_SYMBOL_NIBBLE(0xF),
+};
+// clang-format on
+
+/**
+ * \brief Encodes a single colour byte into its four SPI bytes.
+ *
+ * The result is laid out for a little-endian 32 bit store.
+ */
+static inline uint32_t ws2812_spi_encode_byte(uint8_t data) {
+    return ws2812_spi_nibble_lut[data >> 4] | ((uint32_t)ws2812_spi_nibble_lut[data & 0x0F] << 16);
+}
+
+/**
+ * \brief Encodes a LED into `out`, one 32 bit word per channel.
+ *
+ * `ws2812_led_t` already stores its channels in wire order, so no
+ * byte order handling is needed here.
+ */
+static inline void ws2812_spi_encode_led(uint32_t *out, const ws2812_led_t *led) {
+    const uint8_t *channels = (const uint8_t *)led;
+    for (uint8_t i = 0; i < sizeof(ws2812_led_t); i++) {
+        out[i] = ws2812_spi_encode_byte(channels[i]);
+    }
+}
@@ -43,9 +43,9 @@ void qp_comms_i2c_stop(painter_device_t device) {}
 static const uint8_t cmd_byte  = 0x00;
 static const uint8_t data_byte = 0x40;
 
-void qp_comms_i2c_cmddata_send_command(painter_device_t device, uint8_t cmd) {
+bool qp_comms_i2c_cmddata_send_command(painter_device_t device, uint8_t cmd) {
     uint8_t buf[2] = {cmd_byte, cmd};
-    qp_comms_i2c_send_raw(device, &buf, 2);
+    return qp_comms_i2c_send_raw(device, &buf, 2) == 2;
 }
 
 uint32_t qp_comms_i2c_cmddata_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
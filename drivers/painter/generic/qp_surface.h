@@ -21,6 +21,22 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_MAX_DIRTY_RECTS
+/**
+ * @def This controls the maximum number of separate dirty rectangles tracked by each surface.
+ *      Each one is streamed to the target as its own viewport and pixdata transfer by qp_surface_draw().
+ */
+#    define SURFACE_MAX_DIRTY_RECTS 4
+#endif
+
+#ifndef SURFACE_DIRTY_RECT_MERGE_COST
+/**
+ * @def This is the cost of setting up an extra viewport transfer, expressed as a number of pixels.
+ *      Dirty rectangles are merged whenever transferring their bounding box costs no more than this many extra pixels.
+ */
+#    define SURFACE_DIRTY_RECT_MERGE_COST 64
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -64,4 +80,35 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * Draws an anti-aliased circle onto an RGB565 surface, blending its edges with the existing surface contents.
+ *
+ * @param surface[in] the RGB565 surface to draw onto
+ * @param x[in] the x-location of the center of the circle
+ * @param y[in] the y-location of the center of the circle
+ * @param radius[in] the radius of the circle
+ * @param hue[in] the hue of the circle
+ * @param sat[in] the saturation of the circle
+ * @param val[in] the value of the circle
+ * @param filled[in] whether the circle should be filled, instead of a one pixel wide outline
+ * @return whether the draw operation completed successfully
+ */
+bool qp_surface_circle_aa(painter_device_t surface, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Draws an anti-aliased ellipse onto an RGB565 surface, blending its edges with the existing surface contents.
+ *
+ * @param surface[in] the RGB565 surface to draw onto
+ * @param x[in] the x-location of the center of the ellipse
+ * @param y[in] the y-location of the center of the ellipse
+ * @param sizex[in] the horizontal radius of the ellipse
+ * @param sizey[in] the vertical radius of the ellipse
+ * @param hue[in] the hue of the ellipse
+ * @param sat[in] the saturation of the ellipse
+ * @param val[in] the value of the ellipse
+ * @param filled[in] whether the ellipse should be filled, instead of a one pixel wide outline
+ * @return whether the draw operation completed successfully
+ */
+bool qp_surface_ellipse_aa(painter_device_t surface, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
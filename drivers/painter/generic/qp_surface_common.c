@@ -29,24 +29,99 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
-void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+static inline uint32_t dirty_rect_area(uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    return (uint32_t)(r - l + 1) * (uint32_t)(b - t + 1);
+}
+
+static void qp_surface_merge_dirty_rects(surface_dirty_data_t *dirty, uint8_t index) {
+    // Keep folding other rectangles into the one that just grew, for as long as sending the bounding box is cheaper than a separate transfer
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        if (i == index) {
+            continue;
+        }
+
+        surface_dirty_rect_t *a = &dirty->rects[index];
+        surface_dirty_rect_t *b = &dirty->rects[i];
+        uint16_t              l = QP_MIN(a->l, b->l);
+        uint16_t              t = QP_MIN(a->t, b->t);
+        uint16_t              r = QP_MAX(a->r, b->r);
+        uint16_t              m = QP_MAX(a->b, b->b);
+        if (dirty_rect_area(l, t, r, m) > dirty_rect_area(a->l, a->t, a->r, a->b) + dirty_rect_area(b->l, b->t, b->r, b->b) + SURFACE_DIRTY_RECT_MERGE_COST) {
+            continue;
+        }
+
+        *a = (surface_dirty_rect_t){.l = l, .t = t, .r = r, .b = m};
+
+        // Fill the hole with the last rectangle, following it if it's the one we're merging into
+        uint8_t last = --dirty->rect_count;
+        if (i != last) {
+            dirty->rects[i] = dirty->rects[last];
+            if (index == last) {
+                index = i;
+            }
+        }
+
+        // Start over, as the merged rectangle may now be worth combining with ones already checked
+        i = UINT8_MAX;
+    }
+}
+
+void qp_surface_update_dirty_rect(surface_dirty_data_t *dirty, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    // Nothing to do if the area is already covered by a dirty rectangle
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        surface_dirty_rect_t *rect = &dirty->rects[i];
+        if (l >= rect->l && r <= rect->r && t >= rect->t && b <= rect->b) {
+            return;
+        }
+    }
+
     // Maintain dirty region
-    if (dirty->l > x) {
-        dirty->l        = x;
+    if (dirty->l > l) {
+        dirty->l        = l;
         dirty->is_dirty = true;
     }
-    if (dirty->r < x) {
-        dirty->r        = x;
+    if (dirty->r < r) {
+        dirty->r        = r;
         dirty->is_dirty = true;
     }
-    if (dirty->t > y) {
-        dirty->t        = y;
+    if (dirty->t > t) {
+        dirty->t        = t;
         dirty->is_dirty = true;
     }
-    if (dirty->b < y) {
-        dirty->b        = y;
+    if (dirty->b < b) {
+        dirty->b        = b;
         dirty->is_dirty = true;
     }
+
+    // Work out which rectangle grows the least when extended to cover the area
+    uint8_t  best      = 0;
+    uint32_t best_cost = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        surface_dirty_rect_t *rect = &dirty->rects[i];
+        uint32_t              cost = dirty_rect_area(QP_MIN(rect->l, l), QP_MIN(rect->t, t), QP_MAX(rect->r, r), QP_MAX(rect->b, b)) - dirty_rect_area(rect->l, rect->t, rect->r, rect->b);
+        if (cost < best_cost) {
+            best      = i;
+            best_cost = cost;
+        }
+    }
+
+    // Start a new rectangle if growing an existing one would cost more than transferring the area separately
+    if (best_cost >= dirty_rect_area(l, t, r, b) + SURFACE_DIRTY_RECT_MERGE_COST && dirty->rect_count < SURFACE_MAX_DIRTY_RECTS) {
+        dirty->rects[dirty->rect_count++] = (surface_dirty_rect_t){.l = l, .t = t, .r = r, .b = b};
+        dirty->is_dirty                   = true;
+        return;
+    }
+
+    surface_dirty_rect_t *rect = &dirty->rects[best];
+    rect->l                    = QP_MIN(rect->l, l);
+    rect->t                    = QP_MIN(rect->t, t);
+    rect->r                    = QP_MAX(rect->r, r);
+    rect->b                    = QP_MAX(rect->b, b);
+    qp_surface_merge_dirty_rects(dirty, best);
+}
+
+void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+    qp_surface_update_dirty_rect(dirty, x, y, x, y);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,11 +132,13 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    surface->dirty.l          = 0;
+    surface->dirty.t          = 0;
+    surface->dirty.r          = surface->base.panel_width - 1;
+    surface->dirty.b          = surface->base.panel_height - 1;
+    surface->dirty.rects[0]   = (surface_dirty_rect_t){.l = surface->dirty.l, .t = surface->dirty.t, .r = surface->dirty.r, .b = surface->dirty.b};
+    surface->dirty.rect_count = 1;
+    surface->dirty.is_dirty   = true;
 
     return true;
 }
@@ -82,6 +159,7 @@ bool qp_surface_flush(painter_device_t device) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
+    surface->dirty.rect_count           = 0;
     surface->dirty.is_dirty             = false;
     return true;
 }
@@ -16,12 +16,25 @@ typedef struct surface_painter_driver_vtable_t {
     bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
 } surface_painter_driver_vtable_t;
 
+typedef struct surface_dirty_rect_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_rect_t;
+
 typedef struct surface_dirty_data_t {
-    bool     is_dirty;
+    bool is_dirty;
+
+    // Bounding box of all dirty rectangles
     uint16_t l;
     uint16_t t;
     uint16_t r;
     uint16_t b;
+
+    // Individual dirty rectangles, merged whenever that's cheaper than transferring them separately
+    uint8_t              rect_count;
+    surface_dirty_rect_t rects[SURFACE_MAX_DIRTY_RECTS];
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
@@ -89,6 +102,7 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+void qp_surface_update_dirty_rect(surface_dirty_data_t *dirty, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
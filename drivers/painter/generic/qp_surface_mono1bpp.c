@@ -84,6 +84,47 @@ static bool qp_surface_append_pixels_mono1bpp(painter_device_t device, uint8_t *
     return true;
 }
 
+// Fill an area directly in the framebuffer, marking only the part that actually changed as dirty
+static bool qp_surface_fill_rect_mono1bpp(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, const void *native_pixel) {
+    surface_painter_device_t *surface    = (surface_painter_device_t *)device;
+    uint16_t                  w          = surface->base.panel_width;
+    uint16_t                  h          = surface->base.panel_height;
+    bool                      mono_pixel = (*(const uint8_t *)native_pixel & 1) ? true : false;
+
+    // Drop out if it's off-screen, otherwise clip to the surface
+    if (left >= w || top >= h) {
+        return true;
+    }
+    right  = QP_MIN(right, w - 1);
+    bottom = QP_MIN(bottom, h - 1);
+
+    uint16_t changed_l = UINT16_MAX;
+    uint16_t changed_t = UINT16_MAX;
+    uint16_t changed_r = 0;
+    uint16_t changed_b = 0;
+    for (uint16_t y = top; y <= bottom; ++y) {
+        for (uint16_t x = left; x <= right; ++x) {
+            uint32_t pixel_num   = y * w + x;
+            uint32_t byte_offset = pixel_num / 8;
+            uint8_t  bit_offset  = pixel_num % 8;
+            bool     curr_val    = (surface->u8buffer[byte_offset] & (1 << bit_offset)) ? true : false;
+            if (curr_val != mono_pixel) {
+                surface->u8buffer[byte_offset] ^= (1 << bit_offset);
+                changed_l = QP_MIN(changed_l, x);
+                changed_r = QP_MAX(changed_r, x);
+                changed_t = QP_MIN(changed_t, y);
+                changed_b = y;
+            }
+        }
+    }
+
+    // Skip messing with the dirty info if the original values already matched
+    if (changed_l <= changed_r) {
+        qp_surface_update_dirty_rect(&surface->dirty, changed_l, changed_t, changed_r, changed_b);
+    }
+    return true;
+}
+
 static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
     return false; // Not yet supported.
 }
@@ -104,6 +145,7 @@ const surface_painter_driver_vtable_t mono1bpp_surface_driver_vtable = {
             .palette_convert = qp_surface_palette_convert_mono1bpp,
             .append_pixels   = qp_surface_append_pixels_mono1bpp,
             .append_pixdata  = qp_surface_append_pixdata_mono1bpp,
+            .fill_rect       = qp_surface_fill_rect_mono1bpp,
         },
     .target_pixdata_transfer = mono1bpp_target_pixdata_transfer,
 };
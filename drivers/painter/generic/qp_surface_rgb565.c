@@ -68,18 +68,51 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+// Fill an area directly in the framebuffer, marking only the part that actually changed as dirty
+static bool qp_surface_fill_rect_rgb565(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, const void *native_pixel) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)device;
+    uint16_t                  w       = surface->base.panel_width;
+    uint16_t                  h       = surface->base.panel_height;
+    uint16_t                  rgb565  = *(const uint16_t *)native_pixel;
+
+    // Drop out if it's off-screen, otherwise clip to the surface
+    if (left >= w || top >= h) {
+        return true;
+    }
+    right  = QP_MIN(right, w - 1);
+    bottom = QP_MIN(bottom, h - 1);
+
+    uint16_t changed_l = UINT16_MAX;
+    uint16_t changed_t = UINT16_MAX;
+    uint16_t changed_r = 0;
+    uint16_t changed_b = 0;
+    for (uint16_t y = top; y <= bottom; ++y) {
+        uint16_t *row = &surface->u16buffer[y * w];
+        for (uint16_t x = left; x <= right; ++x) {
+            if (row[x] != rgb565) {
+                row[x]    = rgb565;
+                changed_l = QP_MIN(changed_l, x);
+                changed_r = QP_MAX(changed_r, x);
+                changed_t = QP_MIN(changed_t, y);
+                changed_b = y;
+            }
+        }
+    }
+
+    // Skip messing with the dirty info if the original values already matched
+    if (changed_l <= changed_r) {
+        qp_surface_update_dirty_rect(&surface->dirty, changed_l, changed_t, changed_r, changed_b);
+    }
+    return true;
+}
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+static bool rgb565_target_pixdata_transfer_rect(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
     if (!ok) {
-        qp_dprintf("rgb565_target_pixdata_transfer: fail (could not set target viewport)\n");
+        qp_dprintf("rgb565_target_pixdata_transfer_rect: fail (could not set target viewport)\n");
         return false;
     }
 
@@ -98,7 +131,7 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
             if (pixel_counter == total_pixel_count) {
                 ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
                 if (!ok) {
-                    qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+                    qp_dprintf("rgb565_target_pixdata_transfer_rect: fail (could not stream pixdata to target)\n");
                     return false;
                 }
                 // Reset the counter
@@ -111,7 +144,25 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     if (pixel_counter > 0) {
         ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
         if (!ok) {
-            qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+            qp_dprintf("rgb565_target_pixdata_transfer_rect: fail (could not stream pixdata to target)\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        return rgb565_target_pixdata_transfer_rect(surface_driver, target_driver, x, y, 0, 0, surface_handle->base.panel_width - 1, surface_handle->base.panel_height - 1);
+    }
+
+    // Send each dirty rectangle as its own viewport and pixdata transfer
+    for (uint8_t i = 0; i < surface_handle->dirty.rect_count; ++i) {
+        surface_dirty_rect_t *rect = &surface_handle->dirty.rects[i];
+        if (!rgb565_target_pixdata_transfer_rect(surface_driver, target_driver, x, y, rect->l, rect->t, rect->r, rect->b)) {
             return false;
         }
     }
@@ -136,10 +187,163 @@ const surface_painter_driver_vtable_t rgb565_surface_driver_vtable = {
             .palette_convert = qp_surface_palette_convert_rgb565_swapped,
             .append_pixels   = qp_surface_append_pixels_rgb565,
             .append_pixdata  = qp_surface_append_pixdata_rgb565,
+            .fill_rect       = qp_surface_fill_rect_rgb565,
         },
     .target_pixdata_transfer = rgb565_target_pixdata_transfer,
 };
 
 SURFACE_FACTORY_FUNCTION_IMPL(qp_make_rgb565_surface, rgb565_surface_driver_vtable, 16);
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Anti-aliased primitives
+
+static uint32_t isqrt64(uint64_t value) {
+    uint64_t result = 0;
+    uint64_t bit    = 1ULL << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+// Approximate signed distance from the center of the pixel to the edge of the ellipse, in 1/256ths of a pixel, negative
+// inside. Uses the implicit function divided by the length of its gradient, which is accurate close to the edge.
+static int32_t ellipse_aa_distance(int32_t dx, int32_t dy, int64_t aa, int64_t bb) {
+    int64_t  xx = (int64_t)dx * dx;
+    int64_t  yy = (int64_t)dy * dy;
+    int64_t  f  = (xx * bb) + (yy * aa) - (aa * bb);
+    uint64_t g2 = (uint64_t)(xx * bb * bb) + (uint64_t)(yy * aa * aa);
+    if (g2 == 0) {
+        return INT32_MIN / 2;
+    }
+    return (int32_t)((f * 256) / (2 * (int64_t)isqrt64(g2)));
+}
+
+// Coverage of the pixel from 0-255. Filled shapes extend half a pixel beyond the edge, and outlines are a pixel wide,
+// centered on the edge, so that both cover the same pixels as their aliased counterparts.
+static uint8_t ellipse_aa_coverage(int32_t dx, int32_t dy, int64_t aa, int64_t bb, bool filled) {
+    int32_t d        = ellipse_aa_distance(dx, dy, aa, bb);
+    int32_t coverage = 256 - (filled ? QP_MAX(d, 0) : (d < 0 ? -d : d));
+    return coverage <= 0 ? 0 : (uint8_t)((coverage * 255) >> 8);
+}
+
+// Blend the color into the pixel, weighted by the coverage
+static inline void blendpixel_rgb565(surface_painter_device_t *surface, int32_t x, int32_t y, uint16_t rgb565, uint8_t coverage) {
+    // Drop out if it's off-screen
+    if (x < 0 || y < 0 || x >= surface->base.panel_width || y >= surface->base.panel_height) {
+        return;
+    }
+
+    if (coverage < 255) {
+        // Pixels are stored byte-swapped, ready for transfer to the panel
+        uint16_t under = __builtin_bswap16(surface->u16buffer[y * surface->base.panel_width + x]);
+        uint16_t over  = __builtin_bswap16(rgb565);
+        int32_t  r0    = under >> 11;
+        int32_t  g0    = (under >> 5) & 0x3F;
+        int32_t  b0    = under & 0x1F;
+        int32_t  r     = r0 + ((((int32_t)(over >> 11)) - r0) * coverage) / 255;
+        int32_t  g     = g0 + ((((int32_t)((over >> 5) & 0x3F)) - g0) * coverage) / 255;
+        int32_t  b     = b0 + ((((int32_t)(over & 0x1F)) - b0) * coverage) / 255;
+        rgb565         = __builtin_bswap16((uint16_t)((r << 11) | (g << 5) | b));
+    }
+
+    setpixel_rgb565(surface, x, y, rgb565);
+}
+
+// Fill a solid span, clipped to the surface
+static inline void fillspan_rgb565(surface_painter_device_t *surface, int32_t left, int32_t right, int32_t y, uint16_t rgb565) {
+    if (right < 0 || y < 0 || y > UINT16_MAX) {
+        return;
+    }
+    qp_surface_fill_rect_rgb565((painter_device_t)surface, (uint16_t)QP_MAX(left, 0), (uint16_t)y, (uint16_t)QP_MIN(right, UINT16_MAX), (uint16_t)y, &rgb565);
+}
+
+static void qp_surface_ellipse_aa_impl(surface_painter_device_t *surface, int32_t centerx, int32_t centery, int32_t sizex, int32_t sizey, uint16_t rgb565, bool filled) {
+    int64_t aa = (int64_t)sizex * sizex;
+    int64_t bb = (int64_t)sizey * sizey;
+
+    // Rows are rendered in pairs above and below the center, from the edge inwards
+    for (int32_t dy = 0; dy <= sizey + 1; ++dy) {
+        // Start from the first pixel past the edge with no coverage
+        int32_t dx = (dy < sizey) ? (int32_t)isqrt64((uint64_t)((aa * (bb - (int64_t)dy * dy)) / bb)) + 1 : 1;
+        while (ellipse_aa_coverage(dx, dy, aa, bb, filled) > 0) {
+            ++dx;
+        }
+
+        bool seen = false;
+        while (--dx >= 0) {
+            uint8_t coverage = ellipse_aa_coverage(dx, dy, aa, bb, filled);
+
+            // Coverage only ever increases towards the center, so the rest of a filled row is solid
+            if (filled && coverage == 255) {
+                fillspan_rgb565(surface, centerx - dx, centerx + dx, centery + dy, rgb565);
+                if (dy > 0) {
+                    fillspan_rgb565(surface, centerx - dx, centerx + dx, centery - dy, rgb565);
+                }
+                break;
+            }
+
+            // Outlines fade out again on the inside of the edge
+            if (coverage == 0) {
+                if (seen) {
+                    break;
+                }
+                continue;
+            }
+            seen = true;
+
+            blendpixel_rgb565(surface, centerx + dx, centery + dy, rgb565, coverage);
+            if (dx > 0) {
+                blendpixel_rgb565(surface, centerx - dx, centery + dy, rgb565, coverage);
+            }
+            if (dy > 0) {
+                blendpixel_rgb565(surface, centerx + dx, centery - dy, rgb565, coverage);
+                if (dx > 0) {
+                    blendpixel_rgb565(surface, centerx - dx, centery - dy, rgb565, coverage);
+                }
+            }
+        }
+    }
+}
+
+bool qp_surface_ellipse_aa(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    qp_dprintf("qp_surface_ellipse_aa: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_surface_ellipse_aa: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (driver->driver_vtable != (const painter_driver_vtable_t *)&rgb565_surface_driver_vtable) {
+        qp_dprintf("qp_surface_ellipse_aa: fail (not an RGB565 surface)\n");
+        return false;
+    }
+
+    qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
+    qp_surface_palette_convert_rgb565_swapped(device, 1, &color);
+
+    if (sizex == 0 || sizey == 0) {
+        // Degenerate shapes are just a line, with no edge to smooth
+        qp_surface_fill_rect_rgb565(device, QP_MAX(x - sizex, 0), QP_MAX(y - sizey, 0), QP_MIN(x + sizex, UINT16_MAX), QP_MIN(y + sizey, UINT16_MAX), &color.rgb565);
+    } else {
+        qp_surface_ellipse_aa_impl((surface_painter_device_t *)driver, x, y, sizex, sizey, color.rgb565, filled);
+    }
+
+    qp_dprintf("qp_surface_ellipse_aa: ok\n");
+    return true;
+}
+
+bool qp_surface_circle_aa(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    return qp_surface_ellipse_aa(device, x, y, radius, radius, hue, sat, val, filled);
+}
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
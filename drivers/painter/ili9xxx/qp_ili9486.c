@@ -71,13 +71,14 @@ bool qp_ili9486_init(painter_device_t device, painter_rotation_t rotation) {
 // Driver vtable
 
 // waveshare variant needs some tweaks due to shift registers
-static void qp_comms_spi_dc_reset_send_command_odd_cs_pulse(painter_device_t device, uint8_t cmd) {
+static bool qp_comms_spi_dc_reset_send_command_odd_cs_pulse(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
 
     gpio_write_pin_low(comms_config->spi_config.chip_select_pin);
-    qp_comms_spi_dc_reset_send_command(device, cmd);
+    bool ret = qp_comms_spi_dc_reset_send_command(device, cmd);
     gpio_write_pin_high(comms_config->spi_config.chip_select_pin);
+    return ret;
 }
 
 static uint32_t qp_comms_spi_send_data_odd_cs_pulse(painter_device_t device, const void *data, uint32_t byte_count) {
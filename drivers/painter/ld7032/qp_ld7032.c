@@ -296,6 +296,7 @@ const painter_driver_vtable_t ld7032_driver_vtable = {
     .palette_convert = qp_oled_panel_passthru_palette_convert,
     .append_pixels   = qp_oled_panel_passthru_append_pixels,
     .append_pixdata  = qp_oled_panel_passthru_append_pixdata,
+    .fill_rect       = qp_oled_panel_passthru_fill_rect,
 };
 
 #ifdef QUANTUM_PAINTER_LD7032_SPI_ENABLE
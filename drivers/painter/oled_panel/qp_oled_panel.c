@@ -54,6 +54,11 @@ bool qp_oled_panel_passthru_append_pixdata(painter_device_t device, uint8_t *tar
     return driver->surface.base.validate_ok && driver->surface.base.driver_vtable->append_pixdata(&driver->surface.base, target_buffer, pixdata_offset, pixdata_byte);
 }
 
+bool qp_oled_panel_passthru_fill_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, const void *native_pixel) {
+    oled_panel_painter_device_t *driver = (oled_panel_painter_device_t *)device;
+    return driver->surface.base.validate_ok && driver->surface.base.driver_vtable->fill_rect(&driver->surface.base, left, top, right, bottom, native_pixel);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Flush helpers
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -123,6 +123,7 @@ const oled_panel_painter_driver_vtable_t sh1107_driver_vtable = {
             .palette_convert = qp_oled_panel_passthru_palette_convert,
             .append_pixels   = qp_oled_panel_passthru_append_pixels,
             .append_pixdata  = qp_oled_panel_passthru_append_pixdata,
+            .fill_rect       = qp_oled_panel_passthru_fill_rect,
         },
     .opcodes =
         {
@@ -0,0 +1,223 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+#include "qp_tft_panel.h"
+}
+
+#include <cstring>
+#include <vector>
+
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 80
+
+#define OPCODE_SET_COLUMN_ADDRESS 0x2A
+#define OPCODE_SET_ROW_ADDRESS 0x2B
+#define OPCODE_ENABLE_WRITES 0x2C
+
+// Each viewport is three commands plus two 4-byte windows
+#define VIEWPORT_BYTES (3 + 4 + 4)
+
+// Records everything sent to the fake panel, and replays it into a panel-sized image
+struct comms_recorder {
+    uint32_t              bytes;
+    uint32_t              viewports;
+    uint8_t               command;
+    std::vector<uint8_t>  window;
+    uint16_t              l, t, r, b, x, y;
+    std::vector<uint16_t> image;
+
+    void reset() {
+        bytes     = 0;
+        viewports = 0;
+    }
+} recorder;
+
+static bool recorder_init(painter_device_t device) {
+    return true;
+}
+
+static bool recorder_start(painter_device_t device) {
+    return true;
+}
+
+static void recorder_stop(painter_device_t device) {}
+
+static uint32_t recorder_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    const uint8_t *p = (const uint8_t *)data;
+    recorder.bytes += byte_count;
+
+    if (recorder.command != OPCODE_ENABLE_WRITES) {
+        recorder.window.insert(recorder.window.end(), p, p + byte_count);
+        if (recorder.window.size() == 4) {
+            uint16_t start = (recorder.window[0] << 8) | recorder.window[1];
+            uint16_t end   = (recorder.window[2] << 8) | recorder.window[3];
+            if (recorder.command == OPCODE_SET_COLUMN_ADDRESS) {
+                recorder.l = start;
+                recorder.r = end;
+            } else {
+                recorder.t = start;
+                recorder.b = end;
+            }
+        }
+        return byte_count;
+    }
+
+    for (uint32_t i = 0; i + 1 < byte_count; i += 2) {
+        uint16_t pixel;
+        memcpy(&pixel, &p[i], sizeof(pixel));
+        recorder.image[recorder.y * PANEL_WIDTH + recorder.x] = pixel;
+        if (++recorder.x > recorder.r) {
+            recorder.x = recorder.l;
+            if (++recorder.y > recorder.b) {
+                recorder.y = recorder.t;
+            }
+        }
+    }
+    return byte_count;
+}
+
+static bool recorder_send_command(painter_device_t device, uint8_t cmd) {
+    recorder.bytes += 1;
+    recorder.command = cmd;
+    recorder.window.clear();
+    if (cmd == OPCODE_ENABLE_WRITES) {
+        recorder.viewports++;
+        recorder.x = recorder.l;
+        recorder.y = recorder.t;
+    }
+    return true;
+}
+
+static const painter_comms_with_command_vtable_t recorder_comms_vtable = {
+    .base =
+        {
+            .comms_init  = recorder_init,
+            .comms_start = recorder_start,
+            .comms_stop  = recorder_stop,
+            .comms_send  = recorder_send,
+        },
+    .send_command = recorder_send_command,
+};
+
+static bool panel_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static const tft_panel_dc_reset_painter_driver_vtable_t panel_vtable = {
+    .base =
+        {
+            .init            = panel_init,
+            .power           = qp_tft_panel_power,
+            .clear           = qp_tft_panel_clear,
+            .flush           = qp_tft_panel_flush,
+            .viewport        = qp_tft_panel_viewport,
+            .pixdata         = qp_tft_panel_pixdata,
+            .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
+            .append_pixels   = qp_tft_panel_append_pixels_rgb565,
+            .append_pixdata  = qp_tft_panel_append_pixdata,
+        },
+    .num_window_bytes   = 2,
+    .swap_window_coords = false,
+    .opcodes =
+        {
+            .display_on         = 0x29,
+            .display_off        = 0x28,
+            .set_column_address = OPCODE_SET_COLUMN_ADDRESS,
+            .set_row_address    = OPCODE_SET_ROW_ADDRESS,
+            .enable_writes      = OPCODE_ENABLE_WRITES,
+        },
+};
+
+static uint32_t transfer_bytes(uint16_t w, uint16_t h) {
+    return VIEWPORT_BYTES + (uint32_t)w * h * 2;
+}
+
+class QPSurfaceDirty : public ::testing::Test {
+   protected:
+    uint8_t                  framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+    surface_painter_device_t surface_table[1];
+    painter_driver_t         panel;
+    painter_device_t         surface;
+
+    void SetUp() override {
+        memset(surface_table, 0, sizeof(surface_table));
+        surface = qp_make_rgb565_surface_advanced(surface_table, 1, PANEL_WIDTH, PANEL_HEIGHT, framebuffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        memset(&panel, 0, sizeof(panel));
+        panel.driver_vtable         = (const painter_driver_vtable_t *)&panel_vtable;
+        panel.comms_vtable          = (const painter_comms_vtable_t *)&recorder_comms_vtable;
+        panel.panel_width           = PANEL_WIDTH;
+        panel.panel_height          = PANEL_HEIGHT;
+        panel.native_bits_per_pixel = 16;
+        ASSERT_TRUE(qp_init(&panel, QP_ROTATION_0));
+
+        recorder.image.assign(PANEL_WIDTH * PANEL_HEIGHT, 0xFFFF);
+        recorder.reset();
+
+        // A freshly initialised surface is entirely dirty
+        ASSERT_TRUE(qp_surface_draw(surface, &panel, 0, 0, false));
+        EXPECT_EQ(recorder.viewports, 1);
+        EXPECT_EQ(recorder.bytes, transfer_bytes(PANEL_WIDTH, PANEL_HEIGHT));
+        recorder.reset();
+    }
+
+    void ExpectPanelMatchesSurface() {
+        EXPECT_EQ(memcmp(recorder.image.data(), framebuffer, sizeof(framebuffer)), 0);
+    }
+};
+
+TEST_F(QPSurfaceDirty, UnchangedSurfaceSendsNothing) {
+    ASSERT_TRUE(qp_rect(surface, 0, 0, 9, 9, 0, 0, 0, true));
+    ASSERT_TRUE(qp_surface_draw(surface, &panel, 0, 0, false));
+    EXPECT_EQ(recorder.viewports, 0);
+    EXPECT_EQ(recorder.bytes, 0);
+}
+
+TEST_F(QPSurfaceDirty, OppositeCornersStreamSeparately) {
+    // Clock in the top-left, layer indicator in the bottom-right
+    ASSERT_TRUE(qp_rect(surface, 0, 0, 47, 15, 0, 0, 255, true));
+    ASSERT_TRUE(qp_rect(surface, 200, 64, 239, 79, 85, 255, 255, true));
+    ASSERT_TRUE(qp_surface_draw(surface, &panel, 0, 0, false));
+
+    EXPECT_EQ(recorder.viewports, 2);
+    EXPECT_EQ(recorder.bytes, transfer_bytes(48, 16) + transfer_bytes(40, 16));
+    EXPECT_LT(recorder.bytes, transfer_bytes(PANEL_WIDTH, PANEL_HEIGHT) / 10);
+    ExpectPanelMatchesSurface();
+
+    // Only the digits change on the next tick
+    recorder.reset();
+    ASSERT_TRUE(qp_rect(surface, 24, 4, 35, 11, 170, 255, 255, true));
+    ASSERT_TRUE(qp_surface_draw(surface, &panel, 0, 0, false));
+    EXPECT_EQ(recorder.viewports, 1);
+    EXPECT_EQ(recorder.bytes, transfer_bytes(12, 8));
+    ExpectPanelMatchesSurface();
+}
+
+TEST_F(QPSurfaceDirty, NearbyUpdatesAreMerged) {
+    // The gap between these is cheaper to send than another viewport
+    ASSERT_TRUE(qp_rect(surface, 0, 0, 9, 9, 0, 0, 255, true));
+    ASSERT_TRUE(qp_rect(surface, 12, 0, 21, 9, 0, 0, 255, true));
+    ASSERT_TRUE(qp_surface_draw(surface, &panel, 0, 0, false));
+
+    EXPECT_EQ(recorder.viewports, 1);
+    EXPECT_EQ(recorder.bytes, transfer_bytes(22, 10));
+    ExpectPanelMatchesSurface();
+}
+
+TEST_F(QPSurfaceDirty, RectangleCountIsCapped) {
+    // More scattered updates than there are rectangles to track them
+    for (uint16_t i = 0; i < 8; i++) {
+        ASSERT_TRUE(qp_rect(surface, i * 30, i * 10, i * 30 + 3, i * 10 + 3, 0, 0, 255, true));
+    }
+    ASSERT_TRUE(qp_surface_draw(surface, &panel, 0, 0, false));
+
+    EXPECT_GE(recorder.viewports, 1);
+    EXPECT_LE(recorder.viewports, SURFACE_MAX_DIRTY_RECTS);
+    ExpectPanelMatchesSurface();
+}
@@ -0,0 +1,21 @@
+qp_surface_dirty_DEFS := \
+	-DQUANTUM_PAINTER_ENABLE \
+	-DQUANTUM_PAINTER_SURFACE_ENABLE \
+	-DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE
+qp_surface_dirty_SRC := \
+	$(DRIVER_PATH)/painter/tests/qp_surface_dirty.cpp \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_dummy.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c
+qp_surface_dirty_INC := \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/comms \
+	$(DRIVER_PATH)/painter/generic \
+	$(DRIVER_PATH)/painter/tft_panel
@@ -0,0 +1,2 @@
+TEST_LIST += \
+	qp_surface_dirty
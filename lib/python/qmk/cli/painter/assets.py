@@ -0,0 +1,62 @@
+"""Packs Quantum Painter images and fonts into an asset directory, and writes it to a keyboard's external flash.
+"""
+
+from qmk.path import normpath
+from qmk.painter_assets import pack_assets, AssetUpdater, RAW_HID_USAGE_PAGE, RAW_HID_USAGE
+from milc import cli
+
+
+def _parse_asset(arg):
+    # Either `name=path` or just `path`, with the name taken from the file name
+    if '=' in arg:
+        name, path = arg.split('=', 1)
+    else:
+        path = arg
+        name = normpath(path).name.split('.')[0]
+    return name, normpath(path)
+
+
+@cli.argument('-o', '--output', required=True, help='Specify output asset directory path.')
+@cli.argument('assets', nargs='+', arg_only=True, help='The .qgf and .qff files to pack, optionally as name=path.')
+@cli.subcommand('Packs raw Quantum Painter images and fonts into an asset directory for external flash')
+def painter_pack_assets(cli):
+    assets = []
+    for arg in cli.args.assets:
+        name, path = _parse_asset(arg)
+        assets.append((name, path.read_bytes()))
+
+    try:
+        data = pack_assets(assets)
+    except ValueError as e:
+        cli.log.error(str(e))
+        return False
+
+    output = normpath(cli.args.output)
+    output.write_bytes(data)
+    cli.log.info(f'Wrote {len(assets)} assets ({len(data)} bytes) to {output}')
+
+
+@cli.argument('-d', '--device', required=True, help='Specify the keyboard as VID:PID, in hex.')
+@cli.argument('-i', '--index', default=0, type=int, help='Specify which matching keyboard to use, if more than one is connected.')
+@cli.argument('input', arg_only=True, help='The asset directory to write, as created by `qmk painter-pack-assets`.')
+@cli.subcommand('Writes a Quantum Painter asset directory to a keyboard\'s external flash over raw HID')
+def painter_upload_assets(cli):
+    import hid
+
+    vid, pid = (int(x, 16) for x in cli.args.device.split(':'))
+    devices = [d for d in hid.enumerate(vid, pid) if d['usage_page'] == RAW_HID_USAGE_PAGE and d['usage'] == RAW_HID_USAGE]
+    if cli.args.index >= len(devices):
+        cli.log.error(f'No raw HID interface found for {cli.args.device}')
+        return False
+
+    data = normpath(cli.args.input).read_bytes()
+    device = hid.Device(path=devices[cli.args.index]['path'])
+    try:
+        count = AssetUpdater(device).upload(data, lambda stage, offset, total: cli.log.debug(f'{stage}: {offset}/{total}'))
+    except (IOError, ValueError) as e:
+        cli.log.error(str(e))
+        return False
+    finally:
+        device.close()
+
+    cli.log.info(f'Wrote {count} assets ({len(data)} bytes) to {cli.args.device}')
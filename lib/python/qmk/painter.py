@@ -122,14 +122,17 @@ def _render_image_metadata(metadata):
             if not v["delta"]:
                 continue
 
-            # Unpack rect's coords
-            l, t, r, b = v["delta_rect"]
+            # Unpack each rect's coords
+            rects = []
+            delta_px = 0
+            for l, t, r, b in v["delta_rects"]:
+                rects.append(f"({l:3d}, {t:3d}) - ({r:3d}, {b:3d})")
+                delta_px += (r - l) * (b - t)
 
-            delta_px = (r - l) * (b - t)
             px = size["width"] * size["height"]
 
             # FIXME: May need need more chars here too
-            deltas.append(f"// Frame {i:3d}: ({l:3d}, {t:3d}) - ({r:3d}, {b:3d}) >> {delta_px:4d}/{px:4d} pixels ({100*delta_px/px:.2f}%)")
+            deltas.append(f"// Frame {i:3d}: {', '.join(rects)} >> {delta_px:4d}/{px:4d} pixels ({100*delta_px/px:.2f}%)")
 
         if deltas:
             lines.append("// Areas on delta frames")
@@ -454,3 +457,73 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def compress_bytes_qmk_lz(bytearray):
+    """Compresses the supplied bytes using QMK LZ, a byte-oriented LZ77 variant with a 256-byte history window.
+
+    Each sequence is a token octet, holding the literal count in the upper nibble and the match length (minus 3) in the
+    lower nibble, followed by the literals, then a match distance octet (minus 1). A nibble of 15 means extra length
+    octets follow, each added to the length until one is less than 255. The final sequence may omit its match.
+    """
+    window = 256
+    min_match = 3
+    max_candidates = 16
+    length = len(bytearray)
+    output = []
+    candidates = {}
+
+    def append_length(value):
+        while value >= 255:
+            output.append(255)
+            value -= 255
+        output.append(value)
+
+    def append_sequence(literals, match_length=None, distance=None):
+        literal_nibble = min(len(literals), 15)
+        match_nibble = 0 if match_length is None else min(match_length - min_match, 15)
+        output.append((literal_nibble << 4) | match_nibble)
+        if literal_nibble == 15:
+            append_length(len(literals) - 15)
+        output.extend(literals)
+        if match_length is not None:
+            output.append(distance - 1)
+            if match_nibble == 15:
+                append_length(match_length - min_match - 15)
+
+    def remember(pos):
+        if pos + min_match <= length:
+            positions = candidates.setdefault(bytes(bytearray[pos:pos + min_match]), [])
+            positions.append(pos)
+            if len(positions) > max_candidates:
+                positions.pop(0)
+
+    literals_start = 0
+    pos = 0
+    while pos < length:
+        best_length = 0
+        best_distance = 0
+        for candidate in reversed(candidates.get(bytes(bytearray[pos:pos + min_match]), [])):
+            if pos - candidate > window:
+                break
+            # Matches may overlap the bytes being decoded, as the decoder copies one byte at a time
+            match_length = min_match
+            while pos + match_length < length and bytearray[candidate + match_length] == bytearray[pos + match_length]:
+                match_length += 1
+            if match_length > best_length:
+                best_length = match_length
+                best_distance = pos - candidate
+
+        if best_length >= min_match:
+            append_sequence(bytearray[literals_start:pos], best_length, best_distance)
+            for n in range(pos, pos + best_length):
+                remember(n)
+            pos += best_length
+            literals_start = pos
+        else:
+            remember(pos)
+            pos += 1
+
+    if literals_start < length:
+        append_sequence(bytearray[literals_start:])
+    return output
@@ -0,0 +1,109 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Quantum Painter asset directory, for images and fonts held in external flash.
+# See https://docs.qmk.fm/#/quantum_painter_flash_assets for more information.
+
+import struct
+
+ASSETS_MAGIC = 0x415051  # "QPA"
+ASSETS_VERSION = 0x01
+ASSETS_NAME_LENGTH = 16
+ASSETS_HEADER_SIZE = 16
+ASSETS_ENTRY_SIZE = 24
+
+RAW_HID_ID = 0x51
+RAW_HID_REPORT_SIZE = 32
+RAW_HID_USAGE_PAGE = 0xFF60
+RAW_HID_USAGE = 0x61
+
+COMMAND_INFO = 0x01
+COMMAND_ERASE = 0x02
+COMMAND_WRITE = 0x03
+COMMAND_READ = 0x04
+COMMAND_COMMIT = 0x05
+
+FLASH_STATUS = {
+    0: 'success',
+    -1: 'error',
+    -2: 'timeout',
+    -3: 'bad address',
+    -4: 'busy',
+}
+
+
+def pack_assets(assets):
+    """Builds an asset directory from a list of (name, data) tuples, returning the bytes to be written to flash.
+    """
+    names = set()
+    for name, _ in assets:
+        encoded = name.encode('ascii')
+        if len(encoded) == 0 or len(encoded) > ASSETS_NAME_LENGTH or b'\0' in encoded:
+            raise ValueError(f'Asset name "{name}" must be between 1 and {ASSETS_NAME_LENGTH} ASCII characters')
+        if name in names:
+            raise ValueError(f'Asset name "{name}" is used more than once')
+        names.add(name)
+
+    directory = b''
+    data = b''
+    offset = ASSETS_HEADER_SIZE + ASSETS_ENTRY_SIZE * len(assets)
+    for name, asset in assets:
+        directory += struct.pack('<16sII', name.encode('ascii'), offset + len(data), len(asset))
+        data += asset
+
+    total_size = ASSETS_HEADER_SIZE + len(directory) + len(data)
+    count = len(assets)
+    header = struct.pack('<I', ASSETS_MAGIC | (ASSETS_VERSION << 24))
+    header += struct.pack('<HHII', count, ~count & 0xFFFF, total_size, ~total_size & 0xFFFFFFFF)
+    return header + directory + data
+
+
+class AssetUpdater:
+    """Writes a packed asset directory to a keyboard's external flash, over raw HID.
+    """
+    def __init__(self, device):
+        self.device = device
+
+    def _command(self, command, payload=b''):
+        report = bytes([RAW_HID_ID, command]) + payload
+        report = report.ljust(RAW_HID_REPORT_SIZE, b'\0')
+        self.device.write(b'\0' + report)
+        response = self.device.read(RAW_HID_REPORT_SIZE, 5000)
+        if len(response) < 3 or response[0] != RAW_HID_ID or response[1] != command:
+            raise IOError(f'Unexpected response to command {command:#04x}')
+        status = struct.unpack('<b', bytes([response[2]]))[0]
+        if status != 0:
+            raise IOError(f'Command {command:#04x} failed: {FLASH_STATUS.get(status, status)}')
+        return bytes(response[3:])
+
+    def info(self):
+        """Returns the size of the asset region and its sector size.
+        """
+        return struct.unpack('<II', self._command(COMMAND_INFO)[:8])
+
+    def upload(self, data, progress=None):
+        region_size, sector_size = self.info()
+        if len(data) > region_size:
+            raise ValueError(f'Assets are {len(data)} bytes, but only {region_size} bytes are available')
+
+        for offset in range(0, len(data), sector_size):
+            self._command(COMMAND_ERASE, struct.pack('<I', offset))
+            if progress:
+                progress('erase', offset, len(data))
+
+        chunk = RAW_HID_REPORT_SIZE - 7
+        for offset in range(0, len(data), chunk):
+            block = data[offset:offset + chunk]
+            self._command(COMMAND_WRITE, struct.pack('<IB', offset, len(block)) + block)
+            if progress:
+                progress('write', offset, len(data))
+
+        chunk = RAW_HID_REPORT_SIZE - 3
+        for offset in range(0, len(data), chunk):
+            block = data[offset:offset + chunk]
+            if self._command(COMMAND_READ, struct.pack('<IB', offset, len(block)))[:len(block)] != block:
+                raise IOError(f'Verification failed at offset {offset:#x}')
+            if progress:
+                progress('verify', offset, len(data))
+
+        return struct.unpack('<H', self._command(COMMAND_COMMIT)[:2])[0]
@@ -176,33 +176,24 @@ class QGFFramePaletteDescriptorV1:
 
 class QGFFrameDeltaDescriptorV1:
     type_id = 0x04
-    length = 8
+    length = 8  # per rect
+    max_rects = 4  # See qgf.h, QGF_MAX_DELTA_RECTS
 
     def __init__(self):
         self.header = QGFBlockHeader()
         self.header.type_id = QGFFrameDeltaDescriptorV1.type_id
-        self.header.length = QGFFrameDeltaDescriptorV1.length
-        self.left = 0
-        self.top = 0
-        self.right = 0
-        self.bottom = 0
+        self.rects = []
 
     def write(self, fp):
+        self.header.length = len(self.rects) * QGFFrameDeltaDescriptorV1.length
         self.header.write(fp)
-        fp.write(b''  # start off with empty bytes...
-                 + o16(self.left)  # left
-                 + o16(self.top)  # top
-                 + o16(self.right)  # right
-                 + o16(self.bottom)  # bottom
-                 )
-
-    @property
-    def bbox(self):
-        return self.left, self.top, self.right, self.bottom
-
-    @bbox.setter
-    def bbox(self, bbox):
-        self.left, self.top, self.right, self.bottom = bbox
+        for left, top, right, bottom in self.rects:
+            fp.write(b''  # start off with empty bytes...
+                     + o16(left)  # left
+                     + o16(top)  # top
+                     + o16(right)  # right
+                     + o16(bottom)  # bottom
+                     )
 
 
 ########################################################################################################################
@@ -260,21 +251,122 @@ def _for_all_frames(x: FunctionType, /, images):
             frame_num += 1
 
 
-def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwargs):
+def _compress_data(raw_data, use_rle, use_lz):
+    # Pick whichever of the enabled encodings is smallest, preferring raw data if nothing is gained
+    encodings = [(0x00, raw_data)]  # See qp.h, painter_compression_t
+    if use_rle:
+        encodings.append((0x01, qmk.painter.compress_bytes_qmk_rle(raw_data)))
+    if use_lz:
+        encodings.append((0x02, qmk.painter.compress_bytes_qmk_lz(raw_data)))
+    return min(encodings, key=lambda encoding: len(encoding[1]))
+
+
+# The number of unchanged pixels a split needs to skip to be worth setting up another transfer to the display
+DELTA_RECT_COST = 32
+
+
+def _rect_area(rect):
+    return (rect[2] - rect[0]) * (rect[3] - rect[1])
+
+
+def _changed_bbox(diff, region):
+    # Get the bounding box of the differences within the region, in image coordinates
+    bbox = diff.crop(region).getbbox()
+    if bbox:
+        bbox = (bbox[0] + region[0], bbox[1] + region[1], bbox[2] + region[0], bbox[3] + region[1])
+    return bbox
+
+
+def _split_rect(diff, rect):
+    # Find the split along a band of unchanged rows or columns which drops the most unchanged pixels
+    left, top, right, bottom = rect
+    best = None
+    for vertical in (True, False):
+        if vertical:
+            changed = [_changed_bbox(diff, (x, top, x + 1, bottom)) is not None for x in range(left, right)]
+        else:
+            changed = [_changed_bbox(diff, (left, y, right, y + 1)) is not None for y in range(top, bottom)]
+
+        for n in range(1, len(changed)):
+            # Only split at the start of each unchanged band, both sides get shrunk to fit their changes anyway
+            if not changed[n - 1] or changed[n]:
+                continue
+
+            if vertical:
+                first = _changed_bbox(diff, (left, top, left + n, bottom))
+                second = _changed_bbox(diff, (left + n, top, right, bottom))
+            else:
+                first = _changed_bbox(diff, (left, top, right, top + n))
+                second = _changed_bbox(diff, (left, top + n, right, bottom))
+
+            if first and second:
+                saved = _rect_area(rect) - _rect_area(first) - _rect_area(second)
+                if best is None or saved > best[0]:
+                    best = (saved, first, second)
+
+    return best
+
+
+def _delta_rects(diff, bbox):
+    """Splits the changed region of a frame into up to `QGFFrameDeltaDescriptorV1.max_rects` rectangles.
+
+    Rectangles are split wherever that skips more unchanged pixels than the cost of setting up another transfer to the
+    display, so that only the areas which actually changed get redrawn during playback.
+    """
+    rects = [bbox]
+    while len(rects) < QGFFrameDeltaDescriptorV1.max_rects:
+        best = None
+        for idx, rect in enumerate(rects):
+            split = _split_rect(diff, rect)
+            if split and split[0] > DELTA_RECT_COST and (best is None or split[0] > best[0]):
+                best = (split[0], idx, split[1], split[2])
+
+        if best is None:
+            break
+
+        _, idx, first, second = best
+        rects[idx:idx + 1] = [first, second]
+
+    return rects
+
+
+def _convert_rects(frame, rects, format_):
+    # Stack the rectangles on top of each other so they're converted together, sharing a palette
+    width = max(rect[2] - rect[0] for rect in rects)
+    height = sum(rect[3] - rect[1] for rect in rects)
+    stacked = Image.new("RGB", (width, height), frame.getpixel(rects[0][:2]))
+    y = 0
+    for rect in rects:
+        stacked.paste(frame.crop(rect), (0, y))
+        y += rect[3] - rect[1]
+
+    converted = qmk.painter.convert_requested_format(stacked, format_)
+
+    # Each rectangle's data starts on a byte boundary
+    palette = None
+    image_bytes = []
+    y = 0
+    for rect in rects:
+        rect_width = rect[2] - rect[0]
+        rect_height = rect[3] - rect[1]
+        palette, rect_bytes = qmk.painter.convert_image_bytes(converted.crop((0, y, rect_width, y + rect_height)), format_)
+        image_bytes.extend(rect_bytes)
+        y += rect_height
+
+    return palette, image_bytes
+
+
+def _compress_image(frame, last_frame, *, use_rle, use_lz, use_deltas, format_, **_kwargs):
     # Convert the original frame so we can do comparisons
     converted = qmk.painter.convert_requested_format(frame, format_)
     graphic_data = qmk.painter.convert_image_bytes(converted, format_)
 
-    # Convert the raw data to RLE-encoded if requested
-    raw_data = graphic_data[1]
-    if use_rle:
-        rle_data = qmk.painter.compress_bytes_qmk_rle(graphic_data[1])
-    use_raw_this_frame = not use_rle or len(raw_data) <= len(rle_data)
-    image_data = raw_data if use_raw_this_frame else rle_data
+    # Compress the raw data if requested
+    compression, image_data = _compress_data(graphic_data[1], use_rle, use_lz)
 
     # Work out if a delta frame is smaller than injecting it directly
     use_delta_this_frame = False
-    bbox = None
+    rects = None
     if use_deltas and last_frame is not None:
         # If we want to use deltas, then find the difference
         diff = ImageChops.difference(frame, last_frame)
@@ -284,45 +376,36 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
 
         # If we have a valid bounding box...
         if bbox:
-            # ...create the delta frame by cropping the original.
-            delta_frame = frame.crop(bbox)
+            # ...split it up into the regions which actually changed, and create the delta frame by cropping the original.
+            rects = _delta_rects(diff, bbox)
 
             # Convert the delta frame to the requested format
-            delta_converted = qmk.painter.convert_requested_format(delta_frame, format_)
-            delta_graphic_data = qmk.painter.convert_image_bytes(delta_converted, format_)
+            delta_graphic_data = _convert_rects(frame, rects, format_)
 
             # Work out how large the delta frame is going to be with compression etc.
-            delta_raw_data = delta_graphic_data[1]
-            if use_rle:
-                delta_rle_data = qmk.painter.compress_bytes_qmk_rle(delta_graphic_data[1])
-            delta_use_raw_this_frame = not use_rle or len(delta_raw_data) <= len(delta_rle_data)
-            delta_image_data = delta_raw_data if delta_use_raw_this_frame else delta_rle_data
+            delta_compression, delta_image_data = _compress_data(delta_graphic_data[1], use_rle, use_lz)
 
             # If the size of the delta frame (plus delta descriptor) is smaller than the original, use that instead
             # This ensures that if a non-delta is overall smaller in size, we use that in preference due to flash
             # sizing constraints.
-            if (len(delta_image_data) + QGFFrameDeltaDescriptorV1.length) < len(image_data):
+            if (len(delta_image_data) + QGFFrameDeltaDescriptorV1.length * len(rects)) < len(image_data):
                 # Copy across all the delta equivalents so that the rest of the processing acts on those
                 graphic_data = delta_graphic_data
-                raw_data = delta_raw_data
-                rle_data = delta_rle_data
-                use_raw_this_frame = delta_use_raw_this_frame
+                compression = delta_compression
                 image_data = delta_image_data
                 use_delta_this_frame = True
 
         # Default to whole image
-        bbox = bbox or [0, 0, *frame.size]
-        # Fix sze (as per #20296), we need to cast first as tuples are inmutable
-        bbox = list(bbox)
-        bbox[2] -= 1
-        bbox[3] -= 1
+        rects = rects or [(0, 0, *frame.size)]
+        # Fix sze (as per #20296), rects are stored inclusive of their right and bottom edges
+        rects = [(left, top, right - 1, bottom - 1) for left, top, right, bottom in rects]
 
     return {
-        "bbox": bbox,
+        "rects": rects,
         "graphic_data": graphic_data,
         "image_data": image_data,
         "use_delta_this_frame": use_delta_this_frame,
-        "use_raw_this_frame": use_raw_this_frame,
+        "compression": compression,
     }
 
 
@@ -334,11 +417,11 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
 
     # (potentially) Apply RLE and/or delta, and work out output image's information
     outputs = _compress_image(frame, last_frame, **kwargs)
-    bbox = outputs["bbox"]
+    rects = outputs["rects"]
     graphic_data = outputs["graphic_data"]
     image_data = outputs["image_data"]
     use_delta_this_frame = outputs["use_delta_this_frame"]
-    use_raw_this_frame = outputs["use_raw_this_frame"]
+    compression = outputs["compression"]
 
     # Write out the frame descriptor
     frame_offsets.frame_offsets[idx] = fp.tell()
@@ -347,7 +430,7 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
     frame_descriptor.is_delta = use_delta_this_frame
     frame_descriptor.is_transparent = False
     frame_descriptor.format = format_['image_format_byte']
-    frame_descriptor.compression = 0x00 if use_raw_this_frame else 0x01  # See qp.h, painter_compression_t
+    frame_descriptor.compression = compression  # See qp.h, painter_compression_t
     frame_descriptor.delay = frame.info.get('duration', 1000)  # If we're not an animation, just pretend we're delaying for 1000ms
     frame_descriptor.write(fp)
 
@@ -365,7 +448,7 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
     if use_delta_this_frame:
         # Set up the rendering location of where the delta frame should be situated
         delta_descriptor = QGFFrameDeltaDescriptorV1()
-        delta_descriptor.bbox = bbox
+        delta_descriptor.rects = rects
 
         # Write the delta frame to the output
         vprint(f'{f"Frame {idx:3d} delta":26s} {fp.tell():5d}d / {fp.tell():04X}h')
@@ -378,12 +461,7 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
         "delay": frame_descriptor.delay,
     }
     if frame_metadata["delta"]:
-        frame_metadata.update({"delta_rect": [
-            delta_descriptor.left,
-            delta_descriptor.top,
-            delta_descriptor.right,
-            delta_descriptor.bottom,
-        ]})
+        frame_metadata.update({"delta_rects": delta_descriptor.rects})
     metadata.append(frame_metadata)
 
     # Write out the data for this frame to the output
@@ -437,7 +515,7 @@ def _save(im, fp, _filename):
     frame_offsets.write(fp)
 
     # Iterate over each if the input frames, writing it to the output in the process
-    write_frame = functools.partial(_write_frame, format_=encoderinfo["qmk_format"], fp=fp, use_deltas=encoderinfo.get("use_deltas", True), use_rle=encoderinfo.get("use_rle", True), frame_offsets=frame_offsets, metadata=metadata)
+    write_frame = functools.partial(_write_frame, format_=encoderinfo["qmk_format"], fp=fp, use_deltas=encoderinfo.get("use_deltas", True), use_rle=encoderinfo.get("use_rle", True), use_lz=encoderinfo.get("use_lz", False), frame_offsets=frame_offsets, metadata=metadata)
     for_all_frames(write_frame)
 
     # Go back and update the graphics descriptor now that we can determine the final file size
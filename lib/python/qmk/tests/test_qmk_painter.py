@@ -0,0 +1,90 @@
+import random
+
+import qmk.painter
+
+
+def decompress_qmk_lz(data, count):
+    """Decodes QMK LZ the same way as qp_drawimage_byte_lz_decoder(), one byte at a time through a 256-byte window.
+    """
+    stream = iter(data)
+    window = [0] * 256
+    head = 0
+    output = []
+
+    def read_length(nibble):
+        length = nibble
+        if nibble == 15:
+            while True:
+                c = next(stream)
+                length += c
+                if c != 255:
+                    break
+        return length
+
+    literals = 0
+    match = 0
+    match_nibble = 0
+    match_pending = False
+    distance = 0
+    while len(output) < count:
+        while literals == 0 and match == 0:
+            if match_pending:
+                distance = next(stream) + 1
+                match = read_length(match_nibble) + 3
+                match_pending = False
+            else:
+                token = next(stream)
+                literals = read_length(token >> 4)
+                match_nibble = token & 0x0F
+                match_pending = True
+
+        if literals > 0:
+            c = next(stream)
+            literals -= 1
+        else:
+            c = window[(head - distance) & 0xFF]
+            match -= 1
+
+        window[head] = c
+        head = (head + 1) & 0xFF
+        output.append(c)
+
+    return output
+
+
+def assert_round_trip(data):
+    compressed = qmk.painter.compress_bytes_qmk_lz(data)
+    assert all(0 <= b <= 255 for b in compressed)
+    assert decompress_qmk_lz(compressed, len(data)) == list(data)
+    return compressed
+
+
+def test_qmk_lz_round_trip_empty():
+    assert qmk.painter.compress_bytes_qmk_lz(b'') == []
+
+
+def test_qmk_lz_round_trip_literals():
+    # No matches at all, with enough literals to need extension octets
+    data = bytes(range(256)) + bytes(range(255, -1, -1))
+    assert_round_trip(data)
+
+
+def test_qmk_lz_round_trip_runs():
+    # Long runs overlap the bytes being decoded, and need match length extension octets
+    data = b'\x00' * 1000 + b'\xff' * 270 + b'\x55\xaa' * 300
+    compressed = assert_round_trip(data)
+    assert len(compressed) < len(data) // 10
+
+
+def test_qmk_lz_round_trip_distant_matches():
+    # Repeats at the edge of the 256-byte window, and just beyond it
+    rng = random.Random(1)
+    block = bytes(rng.randrange(256) for _ in range(256))
+    assert_round_trip(block + block + bytes(1) + block)
+
+
+def test_qmk_lz_round_trip_random():
+    rng = random.Random(2)
+    for size in (1, 2, 3, 4, 17, 300, 4096):
+        data = bytes(rng.choice(b'abcd\x00\xff') for _ in range(size))
+        assert_round_trip(data)
@@ -16,6 +16,7 @@
 
 #include "spi_master.h"
 #include "chibios_config.h"
+#include "timer.h"
 #include <ch.h>
 #include <hal.h>
 
@@ -59,6 +60,10 @@
 #    endif
 #endif
 
+#ifndef SPI_TIMEOUT
+#    define SPI_TIMEOUT 100
+#endif
+
 static bool spiStarted = false;
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
 static pin_t current_slave_pin     = NO_PIN;
@@ -421,32 +426,76 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     return spi_start_extended(&start_config);
 }
 
+spi_status_t spi_transmit_wait(void) {
+    uint32_t timeout_timer = timer_read32();
+    osalSysLock();
+    while (SPI_DRIVER.state == SPI_ACTIVE) {
+        osalSysUnlock();
+        if (timer_elapsed32(timeout_timer) >= SPI_TIMEOUT) {
+            return SPI_STATUS_TIMEOUT;
+        }
+        osalSysLock();
+    }
+    osalSysUnlock();
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_write(uint8_t data) {
-    uint8_t rxData;
+    uint8_t      rxData;
+    spi_status_t status = spi_transmit_wait();
+    if (status < 0) {
+        return status;
+    }
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
     return rxData;
 }
 
 spi_status_t spi_read(void) {
-    uint8_t data = 0;
+    uint8_t      data   = 0;
+    spi_status_t status = spi_transmit_wait();
+    if (status < 0) {
+        return status;
+    }
     spiReceive(&SPI_DRIVER, 1, &data);
 
     return data;
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_status_t status = spi_transmit_wait();
+    if (status < 0) {
+        return status;
+    }
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_status_t status = spi_transmit_wait();
+    if (status < 0) {
+        return status;
+    }
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_status_t status = spi_transmit_wait();
+    if (status < 0) {
+        return status;
+    }
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
     if (spiStarted) {
+        // Bounded by SPI_TIMEOUT, so a transfer that never completes can't hang the keyboard
+        if (spi_transmit_wait() < 0) {
+            // Stop the DMA before the peripheral is released from under it
+            spiAbort(&SPI_DRIVER);
+        }
         spi_unselect();
         spiStop(&SPI_DRIVER);
         spiStarted = false;
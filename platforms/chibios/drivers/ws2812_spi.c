@@ -1,6 +1,9 @@
+#include <string.h>
 #include "ws2812.h"
+#include "ws2812_spi_encoder.h"
 #include "gpio.h"
 #include "util.h"
+#include "timer.h"
 #include "chibios_config.h"
 
 /* Adapted from https://github.com/gamazeps/ws2812b-chibios-SPIDMA/ */
@@ -22,6 +25,10 @@
 #    define WS2812_SPI_DIVISOR 16
 #endif
 
+#ifndef WS2812_SPI_TIMEOUT
+#    define WS2812_SPI_TIMEOUT 100
+#endif
+
 // Push Pull or Open Drain Configuration
 // Default Push Pull
 #ifndef WS2812_EXTERNAL_PULLUP
@@ -113,60 +120,54 @@
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
-
-/*
- * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
- */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
-}
-
-static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
-
-#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
+#if defined(WS2812_SPI_DOUBLE_BUFFER) && (defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC))
+#    error "WS2812_SPI_DOUBLE_BUFFER cannot be used with WS2812_SPI_USE_CIRCULAR_BUFFER or WS2812_SPI_SYNC"
 #endif
-#ifdef WS2812_RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 3 + j] = get_protocol_eq(color.w, j);
+
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+#    define WS2812_SPI_BUFFER_COUNT 2
+#else
+#    define WS2812_SPI_BUFFER_COUNT 1
 #endif
-}
+
+// Padded to whole words so every buffer, and every encoded LED after the preamble, is word aligned
+#define TXBUF_SIZE ((PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE + 3) & ~3)
+#define WS2812_DIRTY_WORDS ((WS2812_LED_COUNT + 31) / 32)
+
+static uint8_t txbuf[WS2812_SPI_BUFFER_COUNT][TXBUF_SIZE] __attribute__((aligned(4))) = {0};
+
+// Tracks which LEDs are out of date in each transmit buffer
+static uint32_t txbuf_dirty[WS2812_SPI_BUFFER_COUNT][WS2812_DIRTY_WORDS];
+static uint8_t  txbuf_current = 0;
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
+static inline void mark_led_dirty(int index) {
+    for (uint8_t i = 0; i < WS2812_SPI_BUFFER_COUNT; i++) {
+        txbuf_dirty[i][index / 32] |= 1UL << (index % 32);
+    }
+}
+
+static void encode_dirty_leds(uint8_t buffer) {
+    uint32_t *tx_start = (uint32_t *)&txbuf[buffer][PREAMBLE_SIZE];
+
+    for (uint8_t word = 0; word < WS2812_DIRTY_WORDS; word++) {
+        uint32_t dirty = txbuf_dirty[buffer][word];
+        while (dirty) {
+            uint8_t bit = __builtin_ctz(dirty);
+            int     i   = word * 32 + bit;
+            ws2812_spi_encode_led(&tx_start[i * WS2812_CHANNELS], &ws2812_leds[i]);
+            dirty &= dirty - 1;
+        }
+        txbuf_dirty[buffer][word] = 0;
+    }
+}
+
 void ws2812_init(void) {
+    for (int i = 0; i < WS2812_LED_COUNT; i++) {
+        mark_led_dirty(i);
+    }
+
     palSetLineMode(WS2812_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
 
 #ifdef WS2812_SPI_SCK_PIN
@@ -220,17 +221,24 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf[0]), txbuf[0]);
 #endif
 }
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
+    ws2812_led_t led = ws2812_leds[index];
+
+    led.r = red;
+    led.g = green;
+    led.b = blue;
 #if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
+    ws2812_rgb_to_rgbw(&led);
 #endif
+
+    if (memcmp(&led, &ws2812_leds[index], sizeof(ws2812_led_t)) != 0) {
+        ws2812_leds[index] = led;
+        mark_led_dirty(index);
+    }
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -240,17 +248,37 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+    // Encode into the idle buffer while the previous frame may still be sending
+    uint8_t next = txbuf_current ^ 1;
+    encode_dirty_leds(next);
+
+    uint32_t timeout_timer = timer_read32();
+    osalSysLock();
+    while (WS2812_SPI_DRIVER.state == SPI_ACTIVE) {
+        osalSysUnlock();
+        if (timer_elapsed32(timeout_timer) >= WS2812_SPI_TIMEOUT) {
+            // A stalled transfer must not hang the lighting task, drop it and send the new frame instead
+            spiAbort(&WS2812_SPI_DRIVER);
+            osalSysLock();
+            break;
+        }
+        osalSysLock();
     }
+    osalSysUnlock();
+
+    txbuf_current = next;
+#else
+    encode_dirty_leds(txbuf_current);
+#endif
 
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
     // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
 #ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
 #    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf[0]), txbuf[0]);
 #    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf[txbuf_current]), txbuf[txbuf_current]);
 #    endif
 #endif
 }
@@ -0,0 +1,152 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "flash.h"
+#include "flash_file_mock.h"
+
+#ifndef EXTERNAL_FLASH_SIZE
+#    define EXTERNAL_FLASH_SIZE (512 * 1024L)
+#endif
+
+#ifndef EXTERNAL_FLASH_SECTOR_SIZE
+#    define EXTERNAL_FLASH_SECTOR_SIZE (4 * 1024L)
+#endif
+
+#ifndef EXTERNAL_FLASH_BLOCK_SIZE
+#    define EXTERNAL_FLASH_BLOCK_SIZE (64 * 1024L)
+#endif
+
+flash_file_mock_stats_t flash_file_mock_stats       = {0};
+bool                    flash_file_mock_bus_claimed = false;
+
+static FILE *flash_file = NULL;
+
+static flash_status_t flash_file_fill(uint32_t addr, size_t len) {
+    uint8_t erased[256];
+    memset(erased, 0xFF, sizeof(erased));
+    if (fseek(flash_file, addr, SEEK_SET) != 0) {
+        return FLASH_STATUS_ERROR;
+    }
+    while (len > 0) {
+        size_t chunk = len < sizeof(erased) ? len : sizeof(erased);
+        if (fwrite(erased, 1, chunk, flash_file) != chunk) {
+            return FLASH_STATUS_ERROR;
+        }
+        len -= chunk;
+    }
+    return FLASH_STATUS_SUCCESS;
+}
+
+void flash_file_mock_open(FILE *file) {
+    flash_file_mock_close();
+    memset(&flash_file_mock_stats, 0, sizeof(flash_file_mock_stats));
+    flash_file = file;
+    if (!flash_file) {
+        flash_file = tmpfile();
+        flash_file_fill(0, EXTERNAL_FLASH_SIZE);
+    }
+}
+
+void flash_file_mock_close(void) {
+    if (flash_file) {
+        fclose(flash_file);
+        flash_file = NULL;
+    }
+}
+
+void flash_init(void) {
+    if (!flash_file) {
+        flash_file_mock_open(NULL);
+    }
+}
+
+// Like the SPI flash driver, which can't start the bus while another device holds it
+static bool flash_file_bus_available(void) {
+    if (flash_file_mock_bus_claimed) {
+        flash_file_mock_stats.bus_conflicts++;
+        return false;
+    }
+    return true;
+}
+
+flash_status_t flash_is_busy(void) {
+    return flash_file_bus_available() ? FLASH_STATUS_SUCCESS : FLASH_STATUS_BUSY;
+}
+
+flash_status_t flash_begin_erase_chip(void) {
+    return flash_erase_chip();
+}
+
+flash_status_t flash_wait_erase_chip(void) {
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t flash_erase_chip(void) {
+    if (!flash_file_bus_available()) {
+        return FLASH_STATUS_TIMEOUT;
+    }
+    flash_file_mock_stats.erases++;
+    return flash_file_fill(0, EXTERNAL_FLASH_SIZE);
+}
+
+flash_status_t flash_erase_block(uint32_t addr) {
+    if (!flash_file_bus_available()) {
+        return FLASH_STATUS_TIMEOUT;
+    }
+    if (addr >= EXTERNAL_FLASH_SIZE || (addr % EXTERNAL_FLASH_BLOCK_SIZE) != 0) {
+        return FLASH_STATUS_ERROR;
+    }
+    flash_file_mock_stats.erases++;
+    return flash_file_fill(addr, EXTERNAL_FLASH_BLOCK_SIZE);
+}
+
+flash_status_t flash_erase_sector(uint32_t addr) {
+    if (!flash_file_bus_available()) {
+        return FLASH_STATUS_TIMEOUT;
+    }
+    if (addr >= EXTERNAL_FLASH_SIZE || (addr % EXTERNAL_FLASH_SECTOR_SIZE) != 0) {
+        return FLASH_STATUS_ERROR;
+    }
+    flash_file_mock_stats.erases++;
+    return flash_file_fill(addr, EXTERNAL_FLASH_SECTOR_SIZE);
+}
+
+flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
+    if (!flash_file_bus_available()) {
+        return FLASH_STATUS_TIMEOUT;
+    }
+    if (addr > EXTERNAL_FLASH_SIZE || len > EXTERNAL_FLASH_SIZE - addr) {
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+    flash_file_mock_stats.reads++;
+    flash_file_mock_stats.read_bytes += len;
+    if (fseek(flash_file, addr, SEEK_SET) != 0 || fread(buf, 1, len, flash_file) != len) {
+        return FLASH_STATUS_ERROR;
+    }
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len) {
+    if (!flash_file_bus_available()) {
+        return FLASH_STATUS_TIMEOUT;
+    }
+    if (addr > EXTERNAL_FLASH_SIZE || len > EXTERNAL_FLASH_SIZE - addr) {
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+    flash_file_mock_stats.writes++;
+
+    // Like NOR flash, programming can only clear bits -- anything else needs an erase first
+    const uint8_t *src = (const uint8_t *)buf;
+    for (size_t i = 0; i < len; ++i) {
+        uint8_t current;
+        if (fseek(flash_file, addr + i, SEEK_SET) != 0 || fread(&current, 1, 1, flash_file) != 1) {
+            return FLASH_STATUS_ERROR;
+        }
+        current &= src[i];
+        if (fseek(flash_file, addr + i, SEEK_SET) != 0 || fwrite(&current, 1, 1, flash_file) != 1) {
+            return FLASH_STATUS_ERROR;
+        }
+    }
+    return FLASH_STATUS_SUCCESS;
+}
@@ -0,0 +1,36 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Counts of operations performed on the mocked flash, for tests to verify access patterns
+typedef struct flash_file_mock_stats_t {
+    uint32_t reads;
+    uint32_t read_bytes;
+    uint32_t writes;
+    uint32_t erases;
+    uint32_t bus_conflicts;
+} flash_file_mock_stats_t;
+
+extern flash_file_mock_stats_t flash_file_mock_stats;
+
+// Models another device holding the bus shared with the flash, which makes every flash operation fail until released
+extern bool flash_file_mock_bus_claimed;
+
+// Backs the flash driver API with the supplied file, or with a freshly-erased temporary file if NULL
+void flash_file_mock_open(FILE *file);
+
+// Releases the backing file, if any
+void flash_file_mock_close(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -108,3 +108,88 @@ rgb_t hsv_to_rgb(hsv_t hsv) {
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+/*
+ * Batch conversion
+ *
+ * Each hue is split into a colour wheel region and the remainder within
+ * that region, in the same way as hsv_to_rgb_impl(). Region 6 (hue 255)
+ * is equivalent to region 0, and region 6 is reused for greys, whose
+ * channels are all equal to the value.
+ */
+#define HUE_REGION(h) ((h) * 6 / 255)
+#define HUE_REMAINDER(h) ((uint8_t)(((h) * 2 - HUE_REGION(h) * 85) * 3))
+#define HUE_ENTRY(h) ((uint16_t)((HUE_REGION(h) % 6) << 8 | HUE_REMAINDER(h)))
+
+#define HUE_REGION_GREY 6
+
+#ifndef __AVR__
+// clang-format off
+#    define HUE_ENTRY_4(h) HUE_ENTRY(h), HUE_ENTRY((h) + 1), HUE_ENTRY((h) + 2), HUE_ENTRY((h) + 3)
+#    define HUE_ENTRY_16(h) HUE_ENTRY_4(h), HUE_ENTRY_4((h) + 4), HUE_ENTRY_4((h) + 8), HUE_ENTRY_4((h) + 12)
+#    define HUE_ENTRY_64(h) HUE_ENTRY_16(h), HUE_ENTRY_16((h) + 16), HUE_ENTRY_16((h) + 32), HUE_ENTRY_16((h) + 48)
+static const uint16_t hue_table[256] = {
+    HUE_ENTRY_64(0), HUE_ENTRY_64(64), HUE_ENTRY_64(128), HUE_ENTRY_64(192),
+};
+// clang-format on
+#endif
+
+static inline uint16_t hue_lookup(uint8_t h) {
+#ifdef __AVR__
+    // Not worth the flash on AVR
+    return HUE_ENTRY(h);
+#else
+    return hue_table[h];
+#endif
+}
+
+enum { CHANNEL_V, CHANNEL_P, CHANNEL_Q, CHANNEL_T };
+
+// clang-format off
+static const uint8_t region_channels[7][3] = {
+    { CHANNEL_V, CHANNEL_T, CHANNEL_P },
+    { CHANNEL_Q, CHANNEL_V, CHANNEL_P },
+    { CHANNEL_P, CHANNEL_V, CHANNEL_T },
+    { CHANNEL_P, CHANNEL_Q, CHANNEL_V },
+    { CHANNEL_T, CHANNEL_P, CHANNEL_V },
+    { CHANNEL_V, CHANNEL_P, CHANNEL_Q },
+    { CHANNEL_V, CHANNEL_V, CHANNEL_V }, // HUE_REGION_GREY
+};
+// clang-format on
+
+static void hsv_to_rgb_batch_impl(const hsv_t *hsv, rgb_t *rgb, uint16_t count, bool use_cie) {
+    for (uint16_t i = 0; i < count; i++) {
+        uint16_t hue       = hue_lookup(hsv[i].h);
+        uint8_t  remainder = hue & 0xFF;
+        uint16_t s         = hsv[i].s;
+        uint16_t v         = hsv[i].v;
+#ifdef USE_CIE1931_CURVE
+        if (use_cie) {
+            v = pgm_read_byte(&CIE1931_CURVE[v]);
+        }
+#endif
+
+        uint8_t channels[4];
+        channels[CHANNEL_V] = v;
+        channels[CHANNEL_P] = (v * (255 - s)) >> 8;
+        channels[CHANNEL_Q] = (v * (255 - ((s * remainder) >> 8))) >> 8;
+        channels[CHANNEL_T] = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+        const uint8_t *map = region_channels[s ? hue >> 8 : HUE_REGION_GREY];
+        rgb[i].r           = channels[map[0]];
+        rgb[i].g           = channels[map[1]];
+        rgb[i].b           = channels[map[2]];
+    }
+}
+
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint16_t count) {
+#ifdef USE_CIE1931_CURVE
+    hsv_to_rgb_batch_impl(hsv, rgb, count, true);
+#else
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+#endif
+}
+
+void hsv_to_rgb_nocie_batch(const hsv_t *hsv, rgb_t *rgb, uint16_t count) {
+    hsv_to_rgb_batch_impl(hsv, rgb, count, false);
+}
@@ -95,3 +95,11 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+
+/**
+ * \brief Converts `count` HSV values to RGB in a single pass.
+ *
+ * Produces the same output as calling `hsv_to_rgb()` (or `hsv_to_rgb_nocie()`) on each element.
+ */
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint16_t count);
+void hsv_to_rgb_nocie_batch(const hsv_t *hsv, rgb_t *rgb, uint16_t count);
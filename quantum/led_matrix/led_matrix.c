@@ -74,8 +74,9 @@ last_hit_t g_last_hit_tracker;
 static bool            suspend_state     = false;
 static uint8_t         led_last_enable   = UINT8_MAX;
 static uint8_t         led_last_effect   = UINT8_MAX;
-static effect_params_t led_effect_params = {0, LED_FLAG_ALL, false};
+static effect_params_t led_effect_params = {0, LED_FLAG_ALL, false, 0};
 static led_task_states led_task_state    = SYNCING;
+static bool            driver_shutdown   = false;
 
 // double buffers
 static uint32_t led_timer_buffer;
@@ -251,6 +252,10 @@ static void led_task_start(void) {
     // reset iter
     led_effect_params.iter = 0;
 
+    // the frame is rendered at a single point in time, however many task runs it takes
+    uint32_t delta          = led_timer_buffer - g_led_timer;
+    led_effect_params.delta = delta > UINT16_MAX ? UINT16_MAX : delta;
+
     // update double buffers
     g_led_timer = led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
@@ -264,6 +269,7 @@ static void led_task_start(void) {
 static void led_task_render(uint8_t effect) {
     bool rendering         = false;
     led_effect_params.init = (effect != led_last_effect) || (led_matrix_eeconfig.enable != led_last_enable);
+    if (led_effect_params.init) led_effect_params.delta = 0;
     if (led_effect_params.flags != led_matrix_eeconfig.flags) {
         led_effect_params.flags = led_matrix_eeconfig.flags;
         led_matrix_set_value_all(0);
@@ -331,15 +337,17 @@ static void led_task_flush(uint8_t effect) {
     // update pwm buffers
     led_matrix_update_pwm_buffers();
 
+    // the LEDs are now dark, so there is nothing left to do until they light up again
+    if (effect == LED_MATRIX_NONE && !driver_shutdown) {
+        if (led_matrix_driver.shutdown) led_matrix_driver.shutdown();
+        driver_shutdown = true;
+    }
+
     // next task
     led_task_state = SYNCING;
 }
 
 void led_matrix_task(void) {
-    led_task_timers();
-
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
 #if LED_MATRIX_TIMEOUT > 0
                              (last_input_activity_elapsed() > (uint32_t)LED_MATRIX_TIMEOUT) ||
@@ -348,6 +356,19 @@ void led_matrix_task(void) {
 
     uint8_t effect = suspend_backlight || !led_matrix_eeconfig.enable ? 0 : led_matrix_eeconfig.mode;
 
+    // Once a dark frame has been flushed the driver is shut down and the task
+    // sleeps, only keeping an eye on EEPROM writes, until lighting comes back
+    if (driver_shutdown) {
+        if (!effect) {
+            eeconfig_flush_led_matrix(false);
+            return;
+        }
+        if (led_matrix_driver.wakeup) led_matrix_driver.wakeup();
+        driver_shutdown = false;
+    }
+
+    led_task_timers();
+
     switch (led_task_state) {
         case STARTING:
             led_task_start();
@@ -16,21 +16,68 @@
  */
 
 #include "led_matrix_drivers.h"
+#include "gpio.h"
 
 /* Each driver needs to define a struct:
  *
  *    const led_matrix_driver_t led_matrix_driver;
  *
- * All members must be provided. Keyboard custom drivers must define this
- * in their own files.
+ * All members except shutdown and wakeup must be provided. Keyboard custom
+ * drivers must define this in their own files.
  */
 
+#if defined(LED_MATRIX_IS31FL3218) && defined(IS31FL3218_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3218_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3236) && defined(IS31FL3236_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3236_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3729) && defined(IS31FL3729_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3729_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3731) && defined(IS31FL3731_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3731_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3733) && defined(IS31FL3733_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3733_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3736) && defined(IS31FL3736_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3736_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3737) && defined(IS31FL3737_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3737_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3741) && defined(IS31FL3741_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3741_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3742A) && defined(IS31FL3742A_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3742A_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3743A) && defined(IS31FL3743A_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3743A_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3745) && defined(IS31FL3745_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3745_SDB_PIN
+#elif defined(LED_MATRIX_IS31FL3746A) && defined(IS31FL3746A_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN IS31FL3746A_SDB_PIN
+#elif defined(LED_MATRIX_SNLED27351) && defined(SNLED27351_SDB_PIN)
+#    define LED_MATRIX_SHUTDOWN_PIN SNLED27351_SDB_PIN
+#endif
+
+#if defined(LED_MATRIX_SHUTDOWN_PIN)
+/* Hardware shutdown through the SDB pin. Registers are retained while shut
+ * down, so nothing needs restoring on wakeup.
+ */
+static void led_matrix_driver_shutdown(void) {
+    gpio_write_pin_low(LED_MATRIX_SHUTDOWN_PIN);
+}
+
+static void led_matrix_driver_wakeup(void) {
+    gpio_write_pin_high(LED_MATRIX_SHUTDOWN_PIN);
+}
+
+#    define LED_MATRIX_SHUTDOWN_HOOKS .shutdown = led_matrix_driver_shutdown, .wakeup = led_matrix_driver_wakeup,
+#else
+#    define LED_MATRIX_SHUTDOWN_HOOKS
+#endif
+
 #if defined(LED_MATRIX_IS31FL3218)
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3218_init,
     .flush         = is31fl3218_update_pwm_buffers,
     .set_value     = is31fl3218_set_value,
     .set_value_all = is31fl3218_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3236)
@@ -39,6 +86,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3236_flush,
     .set_value     = is31fl3236_set_value,
     .set_value_all = is31fl3236_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3729)
@@ -47,6 +95,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3729_flush,
     .set_value     = is31fl3729_set_value,
     .set_value_all = is31fl3729_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3731)
@@ -55,6 +104,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3731_flush,
     .set_value     = is31fl3731_set_value,
     .set_value_all = is31fl3731_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3733)
@@ -63,6 +113,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3733_flush,
     .set_value     = is31fl3733_set_value,
     .set_value_all = is31fl3733_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3736)
@@ -71,6 +122,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3736_flush,
     .set_value     = is31fl3736_set_value,
     .set_value_all = is31fl3736_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3737)
@@ -79,6 +131,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3737_flush,
     .set_value     = is31fl3737_set_value,
     .set_value_all = is31fl3737_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3741)
@@ -87,6 +140,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3741_flush,
     .set_value     = is31fl3741_set_value,
     .set_value_all = is31fl3741_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3742A)
@@ -95,6 +149,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3742a_flush,
     .set_value     = is31fl3742a_set_value,
     .set_value_all = is31fl3742a_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3743A)
@@ -103,6 +158,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3743a_flush,
     .set_value     = is31fl3743a_set_value,
     .set_value_all = is31fl3743a_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3745)
@@ -111,6 +167,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3745_flush,
     .set_value     = is31fl3745_set_value,
     .set_value_all = is31fl3745_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_IS31FL3746A)
@@ -119,6 +176,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = is31fl3746a_flush,
     .set_value     = is31fl3746a_set_value,
     .set_value_all = is31fl3746a_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(LED_MATRIX_SNLED27351)
@@ -127,6 +185,7 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = snled27351_flush,
     .set_value     = snled27351_set_value,
     .set_value_all = snled27351_set_value_all,
+    LED_MATRIX_SHUTDOWN_HOOKS
 };
 
 #endif
@@ -43,6 +43,10 @@ typedef struct {
     void (*set_value_all)(uint8_t value);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Optional: power the LEDs down once they have been flushed dark. */
+    void (*shutdown)(void);
+    /* Optional: power the LEDs back up before the next frame is rendered. */
+    void (*wakeup)(void);
 } led_matrix_driver_t;
 
 extern const led_matrix_driver_t led_matrix_driver;
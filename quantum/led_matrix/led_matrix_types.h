@@ -49,6 +49,7 @@ typedef struct PACKED {
     uint8_t     iter;
     led_flags_t flags;
     bool        init;
+    uint16_t    delta; // milliseconds since the previous frame, 0 when init is set
 } effect_params_t;
 
 typedef struct PACKED {
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_lvgl.h"
+#include "qp_comms.h"
 #include "timer.h"
 #include "deferred_exec.h"
 #include "lvgl.h"
@@ -19,19 +20,79 @@ static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_ta
 painter_device_t selected_display = NULL;
 void *           color_buffer     = NULL;
 
+// The display driver whose most recent area is still being transmitted, with comms left open until the transfer completes
+static lv_disp_drv_t *flush_pending = NULL;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter LVGL Integration Internal: qp_lvgl_flush_complete
+
+static void qp_lvgl_flush_complete(bool last_area) {
+    if (flush_pending) {
+        lv_disp_drv_t *disp = flush_pending;
+        flush_pending       = NULL;
+
+        // Stopping comms waits for any transfer still in flight, after which LVGL may render into the buffer again
+        qp_comms_stop(selected_display);
+
+        // Panels with their own framebuffer only need pushing once all of LVGL's dirty areas for this refresh are in
+        if (last_area) {
+            qp_flush(selected_display);
+        }
+        lv_disp_flush_ready(disp);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter LVGL Integration Internal: qp_lvgl_wait
+
+// Invoked by LVGL whenever it needs a draw buffer that's still being flushed
+static void qp_lvgl_wait(lv_disp_drv_t *disp) {
+    qp_lvgl_flush_complete(false);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter LVGL Integration Internal: qp_lvgl_flush
 
 void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     if (selected_display) {
-        uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
-        qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
-        qp_pixdata(selected_display, (void *)color_p, number_pixels);
-        qp_flush(selected_display);
-        lv_disp_flush_ready(disp);
+        painter_driver_t *driver        = (painter_driver_t *)selected_display;
+        uint32_t          number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+
+        // LVGL waits for the previous flush before handing over another buffer, but make sure regardless
+        qp_lvgl_flush_complete(false);
+
+        if (!qp_comms_start(selected_display)) {
+            qp_dprintf("qp_lvgl_flush: fail (could not start comms)\n");
+            lv_disp_flush_ready(disp);
+            return;
+        }
+
+        // Each dirty area is sent as its own viewport within the panel, as panels only have a single write window
+        driver->driver_vtable->viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
+        driver->driver_vtable->pixdata(selected_display, (void *)color_p, number_pixels);
+        flush_pending = disp;
+
+        bool last_area = lv_disp_flush_is_last(disp);
+#if QP_LVGL_DOUBLE_BUFFER
+        // Leave the transfer in flight while LVGL renders the next area into the other buffer. The display's comms stay
+        // started until then, so anything sharing its bus has to go through qp_comms_suspend() in the meantime.
+        if (!last_area) {
+            return;
+        }
+#endif // QP_LVGL_DOUBLE_BUFFER
+        qp_lvgl_flush_complete(last_area);
     }
 }
 
+#ifdef QUANTUM_PAINTER_DEBUG
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter LVGL Integration Internal: qp_lvgl_monitor
+
+static void qp_lvgl_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px) {
+    qp_dprintf("qp_lvgl_monitor: refreshed %u pixels in %u ms\n", (unsigned)px, (unsigned)time);
+}
+#endif // QUANTUM_PAINTER_DEBUG
+
 static uint32_t tick_task_callback(uint32_t trigger_time, void *cb_arg) {
     lvgl_state_t *  state     = (lvgl_state_t *)cb_arg;
     static uint32_t last_tick = 0;
@@ -95,18 +156,23 @@ bool qp_lvgl_attach(painter_device_t device) {
 
     // Set up lvgl display buffer
     static lv_disp_draw_buf_t draw_buf;
-    // Allocate a buffer for 1/10 screen size
-    const size_t count_required   = driver->panel_width * driver->panel_height / 10;
-    void *       new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required);
+    // Allocate a buffer for 1/QP_LVGL_BUFFER_DIVISOR screen size, or two of them if double-buffered
+#if QP_LVGL_DOUBLE_BUFFER
+    const uint8_t buffer_count = 2;
+#else  // QP_LVGL_DOUBLE_BUFFER
+    const uint8_t buffer_count = 1;
+#endif // QP_LVGL_DOUBLE_BUFFER
+    const size_t count_required   = driver->panel_width * driver->panel_height / QP_LVGL_BUFFER_DIVISOR;
+    void *       new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required * buffer_count);
     if (!new_color_buffer) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up memory buffer)\n");
         qp_lvgl_detach();
         return false;
     }
     color_buffer = new_color_buffer;
-    memset(color_buffer, 0, sizeof(lv_color_t) * count_required);
+    memset(color_buffer, 0, sizeof(lv_color_t) * count_required * buffer_count);
     // Initialize the display buffer.
-    lv_disp_draw_buf_init(&draw_buf, color_buffer, NULL, count_required);
+    lv_disp_draw_buf_init(&draw_buf, color_buffer, buffer_count > 1 ? ((lv_color_t *)color_buffer) + count_required : NULL, count_required);
 
     selected_display = device;
 
@@ -117,10 +183,14 @@ bool qp_lvgl_attach(painter_device_t device) {
     static lv_disp_drv_t disp_drv;     /*Descriptor of a display driver*/
     lv_disp_drv_init(&disp_drv);       /*Basic initialization*/
     disp_drv.flush_cb = qp_lvgl_flush; /*Set your driver function*/
+    disp_drv.wait_cb  = qp_lvgl_wait;  /*Complete any pending flush when LVGL needs its buffer back*/
     disp_drv.draw_buf = &draw_buf;     /*Assign the buffer to the display*/
     disp_drv.hor_res  = panel_width;   /*Set the horizontal resolution of the display*/
     disp_drv.ver_res  = panel_height;  /*Set the vertical resolution of the display*/
-    lv_disp_drv_register(&disp_drv);   /*Finally register the driver*/
+#ifdef QUANTUM_PAINTER_DEBUG
+    disp_drv.monitor_cb = qp_lvgl_monitor; /*Report the time taken by each refresh*/
+#endif // QUANTUM_PAINTER_DEBUG
+    lv_disp_drv_register(&disp_drv); /*Finally register the driver*/
 
     return true;
 }
@@ -132,6 +202,9 @@ void qp_lvgl_detach(void) {
     for (int i = 0; i < 2; ++i) {
         cancel_deferred_exec_advanced(lvgl_executors, 2, lvgl_states[i].defer_token);
     }
+    if (selected_display) {
+        qp_lvgl_flush_complete(true);
+    }
     if (color_buffer) {
         free(color_buffer);
         color_buffer = NULL;
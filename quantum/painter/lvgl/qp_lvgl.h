@@ -11,6 +11,22 @@
 #    define QP_LVGL_TASK_PERIOD 5
 #endif
 
+#ifndef QP_LVGL_BUFFER_DIVISOR
+/**
+ * @def The size of each LVGL draw buffer, as a fraction of the screen size. Smaller divisors use more RAM but let LVGL
+ *      render larger areas before each transfer to the display.
+ */
+#    define QP_LVGL_BUFFER_DIVISOR 10
+#endif
+
+#ifndef QP_LVGL_DOUBLE_BUFFER
+/**
+ * @def This controls whether a second LVGL draw buffer is allocated, allowing LVGL to render the next area while the
+ *      previous one is still being transmitted to the display. Doubles the RAM used by the draw buffers.
+ */
+#    define QP_LVGL_DOUBLE_BUFFER FALSE
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter - LVGL External API
 
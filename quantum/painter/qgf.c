@@ -169,17 +169,24 @@ static bool qgf_read_frame_offset(qp_stream_t *stream, uint16_t frame_number, ui
 }
 
 void qgf_seek_to_frame_descriptor(qp_stream_t *stream, uint16_t frame_number) {
-    // Read the offset
+    // The stream has already been validated, so jump straight to the frame's entry in the frame offsets block
     uint32_t offset = 0;
-    qgf_read_frame_offset(stream, frame_number, &offset);
+    qp_stream_setpos(stream, sizeof(qgf_graphics_descriptor_v1_t) + sizeof(qgf_frame_offsets_v1_t) + frame_number * sizeof(uint32_t));
+    qp_stream_read(&offset, sizeof(uint32_t), 1, stream);
 
     // Move to the offset
     qp_stream_setpos(stream, offset);
 }
 
 bool qgf_validate_frame_descriptor(qp_stream_t *stream, uint16_t frame_number, uint8_t *bpp, bool *has_palette, bool *is_panel_native, bool *is_delta) {
+    // Read the offset, validating the frame offsets block in the process
+    uint32_t offset = 0;
+    if (!qgf_read_frame_offset(stream, frame_number, &offset)) {
+        return false;
+    }
+
     // Seek to the correct location
-    qgf_seek_to_frame_descriptor(stream, frame_number);
+    qp_stream_setpos(stream, offset);
 
     // Read the raw descriptor
     qgf_frame_v1_t frame_descriptor;
@@ -193,6 +200,23 @@ bool qgf_validate_frame_descriptor(qp_stream_t *stream, uint16_t frame_number, u
         return false;
     }
 
+    // Make sure we can decode the frame
+    switch (frame_descriptor.compression_scheme) {
+        case IMAGE_UNCOMPRESSED:
+        case IMAGE_COMPRESSED_RLE:
+            break;
+        case IMAGE_COMPRESSED_LZ:
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+            break;
+#else
+            qp_dprintf("Failed to validate frame_descriptor, LZ compression requires QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION\n");
+            return false;
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+        default:
+            qp_dprintf("Failed to validate frame_descriptor, invalid compression scheme 0x%02X\n", (int)frame_descriptor.compression_scheme);
+            return false;
+    }
+
     return qgf_parse_frame_descriptor(&frame_descriptor, bpp, has_palette, is_panel_native, is_delta, NULL, NULL);
 }
 
@@ -224,10 +248,19 @@ bool qgf_validate_delta_descriptor(qp_stream_t *stream, uint16_t frame_number) {
     }
 
     // Make sure this block is valid
-    if (!qgf_validate_block_header(&delta_descriptor.header, QGF_FRAME_DELTA_DESCRIPTOR_TYPEID, (sizeof(qgf_delta_v1_t) - sizeof(qgf_block_header_v1_t)))) {
+    if (!qgf_validate_block_header(&delta_descriptor.header, QGF_FRAME_DELTA_DESCRIPTOR_TYPEID, -1)) {
+        return false;
+    }
+
+    // Make sure it holds a whole number of rectangles, and no more than we can draw
+    uint32_t rect_count = delta_descriptor.header.length / sizeof(qgf_delta_rect_v1_t);
+    if ((delta_descriptor.header.length % sizeof(qgf_delta_rect_v1_t)) != 0 || rect_count < 1 || rect_count > QGF_MAX_DELTA_RECTS) {
+        qp_dprintf("Failed to validate delta_descriptor, invalid length %d\n", (int)delta_descriptor.header.length);
         return false;
     }
 
+    // Move forward in the stream past any additional rectangles
+    qp_stream_seek(stream, (rect_count - 1) * sizeof(qgf_delta_rect_v1_t), SEEK_CUR);
     return true;
 }
 
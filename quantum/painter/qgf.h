@@ -104,7 +104,7 @@ STATIC_ASSERT(sizeof(qgf_palette_v1_t) == sizeof(qgf_block_header_v1_t), "qgf_pa
 #define QGF_FRAME_DELTA_DESCRIPTOR_TYPEID 0x04
 
 typedef struct QP_PACKED qgf_delta_v1_t {
-    qgf_block_header_v1_t header; // = { .type_id = 0x04, .neg_type_id = (~0x04), .length = 8 }
+    qgf_block_header_v1_t header; // = { .type_id = 0x04, .neg_type_id = (~0x04), .length = (N * 8) }
     uint16_t              left;   // The left pixel location to draw the delta image
     uint16_t              top;    // The top pixel location to draw the delta image
     uint16_t              right;  // The right pixel location to to draw the delta image
@@ -113,6 +113,19 @@ typedef struct QP_PACKED qgf_delta_v1_t {
 
 STATIC_ASSERT(sizeof(qgf_delta_v1_t) == (sizeof(qgf_block_header_v1_t) + 8), "qgf_delta_v1_t must be 13 bytes in v1 of QGF");
 
+// Delta frames may update several disjoint regions -- any further rectangles directly follow the first, and the
+// header length is extended to match (8 * N). Each rectangle's pixel data starts on a byte boundary within the data block.
+typedef struct QP_PACKED qgf_delta_rect_v1_t {
+    uint16_t left;
+    uint16_t top;
+    uint16_t right;
+    uint16_t bottom;
+} qgf_delta_rect_v1_t;
+
+STATIC_ASSERT(sizeof(qgf_delta_rect_v1_t) == 8, "qgf_delta_rect_v1_t must be 8 bytes in v1 of QGF");
+
+#define QGF_MAX_DELTA_RECTS 4
+
 /////////////////////////////////////////
 // Frame data descriptor
 
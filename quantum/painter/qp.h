@@ -56,6 +56,34 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of decoded glyphs that Quantum Painter keeps in RAM, allowing text to be redrawn
+ *      without re-reading the font, and runs of cached glyphs to be sent to the display through a single viewport.
+ *      Each entry requires \ref QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES of RAM, plus a small amount of metadata.
+ *      Defaults to 0, which disables the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES
+/**
+ * @def This controls the maximum size of each decoded glyph held in the glyph cache, in bytes. A glyph needs
+ *      `(width * line_height * bpp + 7) / 8` bytes -- anything larger is drawn directly from the font instead.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES 128
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES
+
+#ifndef QUANTUM_PAINTER_PALETTE_CACHE_SIZE
+/**
+ * @def This controls the number of converted palettes that Quantum Painter keeps in RAM, so that images and text drawn
+ *      repeatedly using the same few color combinations skip palette interpolation and conversion to the display's
+ *      native format. Palettes of up to 16 entries (4bpp) are cached, with each entry requiring 64 bytes of RAM plus
+ *      a small amount of metadata. Defaults to 0, which only reuses the most recently converted palette.
+ */
+#    define QUANTUM_PAINTER_PALETTE_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_SIZE
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +100,32 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+/**
+ * @def This controls whether a second pixel data buffer is allocated, allowing the next block of pixel data to be
+ *      decoded while the previous one is still being transmitted by displays whose comms support it. Doubles the RAM
+ *      used by QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER FALSE
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS
+/**
+ * @def This controls the address of the asset directory within external flash, used by \ref qp_load_image_flash and
+ *      \ref qp_load_font_flash. Must be aligned to the flash sector size.
+ */
+#    define QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS 0
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS
+
+#ifndef QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE
+/**
+ * @def This controls the size of the read-ahead cache held by each image or font loaded from external flash, in bytes.
+ *      Each flash read costs a command and address on top of the data, so larger caches improve decode throughput at
+ *      the cost of RAM for every image and font slot.
+ */
+#    define QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE 64
+#endif // QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -80,6 +134,14 @@
 #    define QUANTUM_PAINTER_SUPPORTS_256_PALETTE FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+/**
+ * @def This controls whether images compressed with QMK LZ are supported. Decoding requires a 256-byte history
+ *      window in RAM, but animations typically need far less flash than with RLE.
+ */
+#    define QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS
 /**
  * @def This controls whether the native color range is supported. This avoids the use of palettes but each image
@@ -129,6 +191,17 @@ typedef struct painter_font_desc_t {
  */
 typedef const painter_font_desc_t *painter_font_handle_t;
 
+/**
+ * @typedef The cost of the most recent animation tick which rendered any frames.
+ */
+typedef struct qp_animation_tick_stats_t {
+    uint8_t  frames;       ///< Number of animation frames rendered
+    uint8_t  transactions; ///< Number of comms transactions, shared by consecutive frames on the same device
+    uint8_t  rects;        ///< Number of regions sent to the devices
+    uint32_t pixels;       ///< Number of pixels sent to the devices
+    uint32_t elapsed;      ///< Time taken, in milliseconds
+} qp_animation_tick_stats_t;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API
 
@@ -353,6 +426,21 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+#ifdef QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+/**
+ * Loads an image from the asset directory held in external flash.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image. Only the image metadata and a small read-ahead cache
+ *       are held in RAM.
+ *
+ * @param name[in] the name of the asset within the directory
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if the asset could not be found, or loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(const char *name);
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
@@ -429,6 +517,15 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
  */
 void qp_stop_animation(deferred_token anim_token);
 
+/**
+ * Retrieves the cost of the most recent animation tick which rendered any frames, for debugging purposes.
+ *
+ * @note Frames due at the same time are rendered during the same tick, sharing comms when they're on the same device.
+ *
+ * @return the statistics for that tick
+ */
+qp_animation_tick_stats_t qp_get_animation_tick_stats(void);
+
 /**
  * Loads a font into memory.
  *
@@ -440,6 +537,21 @@ void qp_stop_animation(deferred_token anim_token);
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
 
+#ifdef QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+/**
+ * Loads a font from the asset directory held in external flash.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font. Fonts are copied into RAM if
+ *       \ref QUANTUM_PAINTER_LOAD_FONTS_TO_RAM is set to TRUE, otherwise glyphs are read through a small read-ahead
+ *       cache.
+ *
+ * @param name[in] the name of the asset within the directory
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if the asset could not be found, or loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash(const char *name);
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+
 /**
  * Closes a font handle when no longer in use.
  *
@@ -488,6 +600,43 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+/**
+ * Redraws text previously drawn at the same location, only sending the glyphs which differ from the previous string.
+ *
+ * @note Any part of the previous string extending past the end of the new string is cleared to black.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position where the text should be drawn onto the device
+ * @param y[in] the y-position where the text should be drawn onto the device
+ * @param font[in] the handle of the font
+ * @param prev[in] the string previously drawn at this location, or NULL to draw every glyph
+ * @param str[in] the string to draw
+ * @return the width (in pixels) of the specified string
+ */
+int16_t qp_drawtext_update(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *prev, const char *str);
+
+/**
+ * Redraws text previously drawn at the same location, only sending the glyphs which differ from the previous string,
+ * recoloring monochrome fonts to the desired foreground/background.
+ *
+ * @note Any part of the previous string extending past the end of the new string is cleared to the background color.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position where the text should be drawn onto the device
+ * @param y[in] the y-position where the text should be drawn onto the device
+ * @param font[in] the handle of the font
+ * @param prev[in] the string previously drawn at this location, or NULL to draw every glyph
+ * @param str[in] the string to draw
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return the width (in pixels) of the specified string
+ */
+int16_t qp_drawtext_update_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *prev, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
@@ -575,3 +724,7 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 #ifdef QUANTUM_PAINTER_LVGL_INTEGRATION_ENABLE
 #    include "qp_lvgl.h"
 #endif // QUANTUM_PAINTER_LVGL_INTEGRATION_ENABLE
+
+#ifdef QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+#    include "qp_flash_assets.h"
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
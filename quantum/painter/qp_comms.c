@@ -6,6 +6,9 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base comms APIs
 
+// The device whose comms are currently started, if any
+static painter_device_t active_device = NULL;
+
 bool qp_comms_init(painter_device_t device) {
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
@@ -23,7 +26,12 @@ bool qp_comms_start(painter_device_t device) {
         return false;
     }
 
-    return driver->comms_vtable->comms_start(device);
+    if (!driver->comms_vtable->comms_start(device)) {
+        return false;
+    }
+
+    active_device = device;
+    return true;
 }
 
 void qp_comms_stop(painter_device_t device) {
@@ -34,6 +42,23 @@ void qp_comms_stop(painter_device_t device) {
     }
 
     driver->comms_vtable->comms_stop(device);
+    if (active_device == device) {
+        active_device = NULL;
+    }
+}
+
+// Releases the bus held by the device currently being drawn to, so that other devices sharing it (such as external
+// flash) can be accessed mid-operation. Returns the device to pass to qp_comms_resume(), or NULL if none was active.
+painter_device_t qp_comms_suspend(void) {
+    painter_device_t device = active_device;
+    if (device) {
+        qp_comms_stop(device);
+    }
+    return device;
+}
+
+bool qp_comms_resume(painter_device_t device) {
+    return !device || qp_comms_start(device);
 }
 
 uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
@@ -46,22 +71,38 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
+// Starts sending the data, leaving it in flight until the next comms operation. The data must not be modified until then.
+uint32_t qp_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (driver && driver->validate_ok && driver->comms_vtable->comms_send_async) {
+        return driver->comms_vtable->comms_send_async(device, data, byte_count);
+    }
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
+    // Without a second pixdata buffer the next chunk would be decoded over the one being sent, so wait for it instead
+    return qp_comms_send(device, data, byte_count);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
-void qp_comms_command(painter_device_t device, uint8_t cmd) {
+bool qp_comms_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
-    comms_vtable->send_command(device, cmd);
+    return comms_vtable->send_command(device, cmd);
 }
 
 void qp_comms_command_databyte(painter_device_t device, uint8_t cmd, uint8_t data) {
-    qp_comms_command(device, cmd);
-    qp_comms_send(device, &data, sizeof(data));
+    if (qp_comms_command(device, cmd)) {
+        qp_comms_send(device, &data, sizeof(data));
+    }
 }
 
 uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const void *data, uint32_t byte_count) {
-    qp_comms_command(device, cmd);
+    if (!qp_comms_command(device, cmd)) {
+        return 0;
+    }
     return qp_comms_send(device, data, byte_count);
 }
 
@@ -15,11 +15,16 @@ bool     qp_comms_init(painter_device_t device);
 bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
+uint32_t qp_comms_send_async(painter_device_t device, const void* data, uint32_t byte_count);
+
+// Temporarily releases the bus held by the device being drawn to, for accessing other devices on the same bus
+painter_device_t qp_comms_suspend(void);
+bool             qp_comms_resume(painter_device_t device);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
-void     qp_comms_command(painter_device_t device, uint8_t cmd);
+bool     qp_comms_command(painter_device_t device, uint8_t cmd);
 void     qp_comms_command_databyte(painter_device_t device, uint8_t cmd, uint8_t data);
 uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const void* data, uint32_t byte_count);
 void     qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t* sequence, size_t sequence_len);
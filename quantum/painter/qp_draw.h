@@ -10,7 +10,14 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+extern uint8_t *qp_internal_global_pixdata_buffer;
+#else
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
+
+// Switches the global pixdata buffer over to the idle one, if double buffering, so that the next block of pixel data can be prepared while the previous one is still being transmitted
+void qp_internal_swap_pixdata_buffer(void);
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -27,6 +34,23 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
+// Accumulates horizontal spans from a rasterizer that moves one row at a time in either direction. Spans touching the
+// pending ones on the same row are combined, and identical spans on adjacent rows are stacked, so that each resulting
+// rectangle is sent with a single qp_internal_fillrect_helper_impl() call.
+typedef struct qp_internal_span_batch_t {
+    bool     pending;
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} qp_internal_span_batch_t;
+
+// Adds a span to the batch, sending whatever was pending first if it can't be combined. Uses the global pixdata buffer with pre-converted native pixels.
+bool qp_internal_span_batch_push(painter_device_t device, qp_internal_span_batch_t* batch, uint16_t y, uint16_t left, uint16_t right);
+
+// Sends any pending spans held by the batch.
+bool qp_internal_span_batch_flush(painter_device_t device, qp_internal_span_batch_t* batch);
+
 // Convert from input pixel data + palette to equivalent pixels
 typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
 typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
@@ -43,12 +67,11 @@ extern qp_pixel_t qp_internal_global_pixel_lookup_table[256];
 extern qp_pixel_t qp_internal_global_pixel_lookup_table[16];
 #endif
 
-// Generates a color-interpolated lookup table based off the number of items, from foreground to background, for use with monochrome image rendering.
-// Returns true if a palette was created, false if the palette is reused.
-// As this uses a global, this may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() below to reset.
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
+// Sets up the global lookup table with a color-interpolated palette based off the number of items, from foreground to background, converted to the device's native pixel format -- for use with monochrome image rendering.
+// The palette already in the lookup table, or a copy held in the palette cache, is reused if the colors and the device's pixel format match.
+bool qp_internal_prepare_recolor_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// Resets the global palette so that it can be regenerated. Needed whenever the lookup table is overwritten with anything other than qp_internal_prepare_recolor_palette().
 void qp_internal_invalidate_palette(void);
 
 // Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
@@ -73,6 +96,15 @@ typedef struct qp_internal_byte_input_state_t {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+        // LZ-specific
+        struct {
+            uint32_t literals;      // number of literal bytes remaining in the current sequence
+            uint32_t match;         // number of bytes remaining to be copied from the history window
+            uint16_t distance;      // how far back in the history window the current match starts
+            uint8_t  match_nibble;  // match length bits from the current sequence's token
+            bool     match_pending; // whether the current sequence's match still needs to be read
+            uint8_t  head;          // write position in the history window
+        } lz;
     };
 } qp_internal_byte_input_state_t;
 
@@ -7,8 +7,11 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
+// Spans are batched per octant, as the rows visited within each octant only ever move in one direction
+#define QP_CIRCLE_SPAN_BATCHES 8
+
 // Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+static bool qp_circle_helper_impl(painter_device_t device, qp_internal_span_batch_t *spans, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
     /*
     Circles have the property of 8-way symmetry, so eight pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
@@ -17,13 +20,15 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
     For filled circles, we can draw horizontal lines between each pair of
     pixels with the same final value of y.
 
-    Two special cases exist and have been optimized:
-    1) offsetx == offsety (the final point), makes half the coordinates
-    equivalent, so we can omit them (and the corresponding fill lines)
-    2) offsetx == 0 (the starting point) means that some horizontal lines
-    would be a single pixel in length, so we write individual pixels instead.
-    This also makes half the symmetrical points identical to their twins,
-    so we only need four points or two points and one line
+    Rather than being sent immediately, each pixel or line is handed to the
+    span batch for its octant. Successive points on the same row are joined
+    into a single run, and identical runs on adjacent rows are stacked into a
+    rectangle, so that each row is sent once at its final width and the
+    straighter parts of the circle are sent in a handful of viewports.
+
+    Points that coincide with their twins are skipped: offsetx == offsety
+    (the final point) is also covered by the other octant, and offsetx == 0
+    or offsety == 0 land on the center row or column.
     */
 
     int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
@@ -35,85 +40,45 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
     int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
     int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
 
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, centerx, ypy)) {
+    bool diagonal = offsetx == offsety;
+
+    if (filled) {
+        if (!qp_internal_span_batch_push(device, &spans[0], ymy, xmx, xpx)) {
             return false;
         }
-        if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
+        if (offsety > 0 && !qp_internal_span_batch_push(device, &spans[1], ypy, xmx, xpx)) {
             return false;
         }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, centery)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, centery)) {
-                return false;
-            }
+        if (!diagonal && !qp_internal_span_batch_push(device, &spans[2], ymx, xmy, xpy)) {
+            return false;
         }
-    } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
-                return false;
-            }
+        if (!diagonal && offsetx > 0 && !qp_internal_span_batch_push(device, &spans[3], ypx, xmy, xpy)) {
+            return false;
         }
-
     } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
+        if (!qp_internal_span_batch_push(device, &spans[0], ymy, xmx, xmx)) {
+            return false;
+        }
+        if (offsetx > 0 && !qp_internal_span_batch_push(device, &spans[1], ymy, xpx, xpx)) {
+            return false;
+        }
+        if (offsety > 0 && !qp_internal_span_batch_push(device, &spans[2], ypy, xmx, xmx)) {
+            return false;
+        }
+        if (offsety > 0 && offsetx > 0 && !qp_internal_span_batch_push(device, &spans[3], ypy, xpx, xpx)) {
+            return false;
+        }
+        if (!diagonal) {
+            if (!qp_internal_span_batch_push(device, &spans[4], ymx, xmy, xmy)) {
                 return false;
             }
-            if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
+            if (offsety > 0 && !qp_internal_span_batch_push(device, &spans[5], ymx, xpy, xpy)) {
                 return false;
             }
-            if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
+            if (offsetx > 0 && !qp_internal_span_batch_push(device, &spans[6], ypx, xmy, xmy)) {
                 return false;
             }
-            if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
+            if (offsetx > 0 && offsety > 0 && !qp_internal_span_batch_push(device, &spans[7], ypx, xpy, xpy)) {
                 return false;
             }
         }
@@ -138,15 +103,19 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
     int16_t ycalc = (int16_t)radius;
     int16_t err   = ((5 - (radius >> 2)) >> 2);
 
-    qp_internal_fill_pixdata(device, (radius * 2) + 1, hue, sat, val);
+    // Batched spans may be sent as rectangles several rows tall
+    uint32_t diameter = (radius * 2) + 1;
+    qp_internal_fill_pixdata(device, diameter * diameter, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_circle: fail (could not start comms)\n");
         return false;
     }
 
+    qp_internal_span_batch_t spans[QP_CIRCLE_SPAN_BATCHES] = {0};
+
     bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+    if (!qp_circle_helper_impl(device, spans, x, y, xcalc, ycalc, filled)) {
         ret = false;
     }
 
@@ -159,13 +128,19 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
                 ycalc--;
                 err += ((xcalc - ycalc) << 1) + 1;
             }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+            if (!qp_circle_helper_impl(device, spans, x, y, xcalc, ycalc, filled)) {
                 ret = false;
                 break;
             }
         }
     }
 
+    for (uint8_t i = 0; ret && i < QP_CIRCLE_SPAN_BATCHES; ++i) {
+        if (!qp_internal_span_batch_flush(device, &spans[i])) {
+            ret = false;
+        }
+    }
+
     qp_dprintf("qp_circle: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
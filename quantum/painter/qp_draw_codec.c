@@ -55,12 +55,9 @@ bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count,
 }
 
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    painter_driver_t* driver = (painter_driver_t*)device;
-    int16_t           steps  = 1 << bits_per_pixel; // number of items we need to interpolate
-    if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps)) {
-        if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
-            return false;
-        }
+    int16_t steps = 1 << bits_per_pixel; // number of items we need to interpolate
+    if (!qp_internal_prepare_recolor_palette(device, fg_hsv888, bg_hsv888, steps)) {
+        return false;
     }
 
     return qp_internal_decode_palette(device, pixel_count, bits_per_pixel, input_callback, input_arg, qp_internal_global_pixel_lookup_table, output_callback, output_arg);
@@ -126,6 +123,78 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+
+// History window shared by all LZ decodes -- only one image or font is ever decoded at a time
+static uint8_t qp_internal_lz_window[256];
+
+// Reads a 4-bit length from a token, along with any extension bytes following it
+static inline int32_t qp_drawimage_lz_read_length(qp_stream_t* stream, uint8_t nibble) {
+    int32_t length = nibble;
+    if (nibble == 15) {
+        int16_t c;
+        do {
+            c = qp_stream_get(stream);
+            if (c < 0) {
+                return -1;
+            }
+            length += c;
+        } while (c == 255);
+    }
+    return length;
+}
+
+static inline int16_t qp_drawimage_byte_lz_decoder(void* cb_arg) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+
+    // Work out if we're parsing the next part of a sequence
+    while (state->lz.literals == 0 && state->lz.match == 0) {
+        if (state->lz.match_pending) {
+            // Literals are done, read where the match comes from and how long it is
+            int16_t distance = qp_stream_get(state->src_stream);
+            int32_t length   = qp_drawimage_lz_read_length(state->src_stream, state->lz.match_nibble);
+            if (distance < 0 || length < 0) {
+                return -1;
+            }
+            state->lz.distance      = distance + 1;
+            state->lz.match         = length + 3;
+            state->lz.match_pending = false;
+        } else {
+            // Start of a new sequence, read the token and the number of literals that follow
+            int16_t token = qp_stream_get(state->src_stream);
+            if (token < 0) {
+                return -1;
+            }
+            int32_t length = qp_drawimage_lz_read_length(state->src_stream, token >> 4);
+            if (length < 0) {
+                return -1;
+            }
+            state->lz.literals      = length;
+            state->lz.match_nibble  = token & 0x0F;
+            state->lz.match_pending = true;
+        }
+    }
+
+    // Work out which byte we're returning
+    int16_t c;
+    if (state->lz.literals > 0) {
+        c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return -1;
+        }
+        state->lz.literals--;
+    } else {
+        c = qp_internal_lz_window[(uint8_t)(state->lz.head - state->lz.distance)];
+        state->lz.match--;
+    }
+
+    // Keep track of everything decoded so far, for later matches
+    qp_internal_lz_window[state->lz.head++] = c;
+    return c;
+}
+
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -139,6 +208,7 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
         if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
             return false;
         }
+        qp_internal_swap_pixdata_buffer();
         state->pixel_write_pos = 0;
     }
 
@@ -159,6 +229,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
         if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
+        qp_internal_swap_pixdata_buffer();
         state->byte_write_pos = 0;
     }
 
@@ -181,6 +252,7 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
             ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+            qp_internal_swap_pixdata_buffer();
         }
     }
 
@@ -198,6 +270,7 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
             ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            qp_internal_swap_pixdata_buffer();
         }
     }
 
@@ -212,6 +285,14 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.literals      = 0;
+            input_state->lz.match         = 0;
+            input_state->lz.match_pending = false;
+            input_state->lz.head          = 0;
+            return qp_drawimage_byte_lz_decoder;
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
         default:
             return NULL;
     }
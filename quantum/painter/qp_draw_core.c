@@ -21,19 +21,59 @@ STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXD
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t                                       *qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[0];
+#else
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
 
-// Static buffer to contain a generated color palette
-static bool                                       generated_palette = false;
-static int16_t                                    generated_steps   = -1;
-__attribute__((__aligned__(4))) static qp_pixel_t interpolated_fg_hsv888;
-__attribute__((__aligned__(4))) static qp_pixel_t interpolated_bg_hsv888;
 #if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table[256];
 #else
 __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table[16];
 #endif
 
+// Identifies an interpolated palette once converted to native pixels -- the device's format is represented by its
+// palette conversion hook and native bpp.
+typedef struct qp_internal_palette_key_t {
+    qp_pixel_t                          fg_hsv888;
+    qp_pixel_t                          bg_hsv888;
+    painter_driver_convert_palette_func palette_convert;
+    uint8_t                             native_bits_per_pixel;
+    int16_t                             steps;
+} qp_internal_palette_key_t;
+
+// The palette currently held in the lookup table, if it was interpolated
+static bool                      active_palette_valid = false;
+static qp_internal_palette_key_t active_palette;
+
+// The most recently converted fill color
+static bool                                       fill_color_valid = false;
+static qp_internal_palette_key_t                  fill_color_key;
+__attribute__((__aligned__(4))) static qp_pixel_t fill_color_native;
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+
+#    if QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 255
+#        error QUANTUM_PAINTER_PALETTE_CACHE_SIZE must be no larger than 255
+#    endif
+
+// Largest palette kept in the cache -- 256-entry palettes are regenerated as required
+#    define QP_PALETTE_CACHE_MAX_ENTRIES 16
+
+typedef struct qp_palette_cache_entry_t {
+    bool                      valid;
+    uint16_t                  last_used;
+    qp_internal_palette_key_t key;
+    qp_pixel_t                palette[QP_PALETTE_CACHE_MAX_ENTRIES];
+} qp_palette_cache_entry_t;
+
+__attribute__((__aligned__(4))) static qp_palette_cache_entry_t palette_cache[QUANTUM_PAINTER_PALETTE_CACHE_SIZE] = {0};
+static uint16_t                                                 palette_cache_stamp                                = 0;
+
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helpers
 
@@ -42,50 +82,79 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+void qp_internal_swap_pixdata_buffer(void) {
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    qp_internal_global_pixdata_buffer = (qp_internal_global_pixdata_buffer == qp_internal_pixdata_buffers[0]) ? qp_internal_pixdata_buffers[1] : qp_internal_pixdata_buffers[0];
+#endif
+}
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
+    if (driver->driver_vtable->fill_rect) {
+        return driver->driver_vtable->fill_rect(device, x, y, x, y, qp_internal_global_pixdata_buffer);
+    }
     return driver->driver_vtable->viewport(device, x, y, x, y) && driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, 1);
 }
 
+static inline qp_internal_palette_key_t qp_internal_make_palette_key(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    return (qp_internal_palette_key_t){
+        .fg_hsv888             = fg_hsv888,
+        .bg_hsv888             = bg_hsv888,
+        .palette_convert       = driver->driver_vtable->palette_convert,
+        .native_bits_per_pixel = driver->native_bits_per_pixel,
+        .steps                 = steps,
+    };
+}
+
+static inline bool qp_internal_palette_key_equal(const qp_internal_palette_key_t *a, const qp_internal_palette_key_t *b) {
+    return a->fg_hsv888.hsv888.h == b->fg_hsv888.hsv888.h && a->fg_hsv888.hsv888.s == b->fg_hsv888.hsv888.s && a->fg_hsv888.hsv888.v == b->fg_hsv888.hsv888.v && a->bg_hsv888.hsv888.h == b->bg_hsv888.hsv888.h && a->bg_hsv888.hsv888.s == b->bg_hsv888.hsv888.s && a->bg_hsv888.hsv888.v == b->bg_hsv888.hsv888.v && a->palette_convert == b->palette_convert && a->native_bits_per_pixel == b->native_bits_per_pixel && a->steps == b->steps;
+}
+
 // Fills the global native pixel buffer with equivalent pixels matching the supplied HSV
 void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint8_t hue, uint8_t sat, uint8_t val) {
+    static const uint8_t palette_indices[32] = {0};
+
     painter_driver_t *driver            = (painter_driver_t *)device;
     uint32_t          pixels_in_pixdata = qp_internal_num_pixels_in_buffer(device);
     num_pixels                          = QP_MIN(pixels_in_pixdata, num_pixels);
 
-    // Convert the color to native pixel format
-    qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
-    driver->driver_vtable->palette_convert(device, 1, &color);
+    // Convert the color to native pixel format, unless it was the last one converted for this format
+    qp_pixel_t                color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
+    qp_internal_palette_key_t key   = qp_internal_make_palette_key(device, color, color, 1);
+    if (!fill_color_valid || !qp_internal_palette_key_equal(&fill_color_key, &key)) {
+        driver->driver_vtable->palette_convert(device, 1, &color);
+        fill_color_key    = key;
+        fill_color_native = color;
+        fill_color_valid  = true;
+    }
 
-    // Append the required number of pixels
-    uint8_t palette_idx = 0;
-    for (uint32_t i = 0; i < num_pixels; ++i) {
-        driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
+    // Append enough pixels to fill a whole number of 32-bit words...
+    uint32_t period_bits = 32;
+    while (period_bits % driver->native_bits_per_pixel) {
+        period_bits += 32;
+    }
+    uint32_t period_pixels = period_bits / driver->native_bits_per_pixel;
+    driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &fill_color_native, 0, QP_MIN(num_pixels, period_pixels), (uint8_t *)palette_indices);
+
+    // ...then replicate those words through the rest of the required pixels
+    if (num_pixels > period_pixels) {
+        uint32_t *words       = (uint32_t *)qp_internal_global_pixdata_buffer;
+        uint32_t  total_words = ((num_pixels * driver->native_bits_per_pixel) + 31) / 32;
+        for (uint32_t i = period_bits / 32; i < total_words; ++i) {
+            words[i] = words[i - (period_bits / 32)];
+        }
     }
 }
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// Resets the global palette so that it can be regenerated.
 void qp_internal_invalidate_palette(void) {
-    generated_palette = false;
-    generated_steps   = -1;
+    active_palette_valid = false;
 }
 
 // Interpolates between two colors to generate a palette
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
-    // Check if we need to generate a new palette -- if the input parameters match then assume the palette can stay unchanged.
-    // This may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() to reset.
-    if (generated_palette == true && generated_steps == steps && memcmp(&interpolated_fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&interpolated_bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
-        // We already have the correct palette, no point regenerating it.
-        return false;
-    }
-
-    // Save the parameters so we know whether we can skip generation
-    generated_palette      = true;
-    generated_steps        = steps;
-    interpolated_fg_hsv888 = fg_hsv888;
-    interpolated_bg_hsv888 = bg_hsv888;
-
+static void qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
     int16_t hue_fg = fg_hsv888.hsv888.h;
     int16_t hue_bg = bg_hsv888.hsv888.h;
 
@@ -104,6 +173,57 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
 
         qp_dprintf("qp_internal_interpolate_palette: %3d of %d -- H: %3d, S: %3d, V: %3d\n", (int)(i + 1), (int)steps, (int)qp_internal_global_pixel_lookup_table[i].hsv888.h, (int)qp_internal_global_pixel_lookup_table[i].hsv888.s, (int)qp_internal_global_pixel_lookup_table[i].hsv888.v);
     }
+}
+
+// Sets up the global lookup table with a native palette interpolated between two colors
+bool qp_internal_prepare_recolor_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    painter_driver_t *        driver = (painter_driver_t *)device;
+    qp_internal_palette_key_t key    = qp_internal_make_palette_key(device, fg_hsv888, bg_hsv888, steps);
+
+    // Check if the lookup table already holds the correct palette, no point regenerating it.
+    if (active_palette_valid && qp_internal_palette_key_equal(&active_palette, &key)) {
+        return true;
+    }
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+    // Look for a previously converted copy, otherwise pick the least-recently-used slot to hold this one
+    qp_palette_cache_entry_t *victim = NULL;
+    if (steps <= QP_PALETTE_CACHE_MAX_ENTRIES) {
+        ++palette_cache_stamp;
+        for (uint8_t i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_SIZE; ++i) {
+            qp_palette_cache_entry_t *entry = &palette_cache[i];
+            if (entry->valid && qp_internal_palette_key_equal(&entry->key, &key)) {
+                memcpy(qp_internal_global_pixel_lookup_table, entry->palette, steps * sizeof(qp_pixel_t));
+                entry->last_used     = palette_cache_stamp;
+                active_palette       = key;
+                active_palette_valid = true;
+                return true;
+            }
+
+            if (!victim || (victim->valid && (!entry->valid || (uint16_t)(palette_cache_stamp - entry->last_used) > (uint16_t)(palette_cache_stamp - victim->last_used)))) {
+                victim = entry;
+            }
+        }
+    }
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+
+    // Generate and convert the palette
+    active_palette_valid = false;
+    qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps);
+    if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
+        return false;
+    }
+    active_palette       = key;
+    active_palette_valid = true;
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+    if (victim) {
+        memcpy(victim->palette, qp_internal_global_pixel_lookup_table, steps * sizeof(qp_pixel_t));
+        victim->key       = key;
+        victim->last_used = palette_cache_stamp;
+        victim->valid     = true;
+    }
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
 
     return true;
 }
@@ -239,6 +359,11 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
     uint16_t w = r - l + 1;
     uint16_t h = b - t + 1;
 
+    // Drivers with direct access to their framebuffer can fill the area without streaming pixel data
+    if (driver->driver_vtable->fill_rect) {
+        return driver->driver_vtable->fill_rect(device, l, t, r, b, qp_internal_global_pixdata_buffer);
+    }
+
     uint32_t remaining = w * h;
     driver->driver_vtable->viewport(device, l, t, r, b);
     while (remaining > 0) {
@@ -251,6 +376,63 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
     return true;
 }
 
+bool qp_internal_span_batch_flush(painter_device_t device, qp_internal_span_batch_t *batch) {
+    if (!batch->pending) {
+        return true;
+    }
+    batch->pending = false;
+    return qp_internal_fillrect_helper_impl(device, batch->l, batch->t, batch->r, batch->b);
+}
+
+bool qp_internal_span_batch_push(painter_device_t device, qp_internal_span_batch_t *batch, uint16_t y, uint16_t left, uint16_t right) {
+    uint16_t l = QP_MIN(left, right);
+    uint16_t r = QP_MAX(left, right);
+
+    if (batch->pending) {
+        // Another span on the first or last row of the pending area, touching the span already there, widens that row
+        if ((y == batch->t || y == batch->b) && l <= batch->r + 1 && r + 1 >= batch->l) {
+            if (l >= batch->l && r <= batch->r) {
+                return true;
+            }
+
+            // If the pending area covers more than this row, send the other rows before widening this one
+            if (batch->t != batch->b) {
+                uint16_t t = batch->t;
+                uint16_t b = batch->b;
+                if (y == b) {
+                    batch->b = b - 1;
+                } else {
+                    batch->t = t + 1;
+                }
+                if (!qp_internal_span_batch_flush(device, batch)) {
+                    return false;
+                }
+                batch->pending = true;
+                batch->t       = y;
+                batch->b       = y;
+            }
+
+            batch->l = QP_MIN(batch->l, l);
+            batch->r = QP_MAX(batch->r, r);
+            return true;
+        }
+
+        // An identical span on an adjacent row extends the pending area
+        if (l == batch->l && r == batch->r && (y == batch->b + 1 || y + 1 == batch->t)) {
+            batch->t = QP_MIN(batch->t, y);
+            batch->b = QP_MAX(batch->b, y);
+            return true;
+        }
+
+        if (!qp_internal_span_batch_flush(device, batch)) {
+            return false;
+        }
+    }
+
+    *batch = (qp_internal_span_batch_t){.pending = true, .l = l, .t = y, .r = r, .b = y};
+    return true;
+}
+
 bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
     qp_dprintf("qp_rect(%d, %d, %d, %d): entry\n", (int)left, (int)top, (int)right, (int)bottom);
     painter_driver_t *driver = (painter_driver_t *)device;
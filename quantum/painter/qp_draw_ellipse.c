@@ -6,8 +6,11 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
+// Spans are batched per quadrant, as the rows visited within each quadrant only ever move in one direction
+#define QP_ELLIPSE_SPAN_BATCHES 4
+
 // Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+static bool qp_ellipse_helper_impl(painter_device_t device, qp_internal_span_batch_t *spans, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
     /*
     Ellipses have the property of 4-way symmetry, so four pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
@@ -16,7 +19,12 @@ static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, ui
     For filled ellipses, we can draw horizontal lines between each pair of
     pixels with the same final value of y.
 
-    When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
+    As with circles, each pixel or line is handed to the span batch for its
+    quadrant rather than being sent immediately, so that each row is sent
+    once and identical rows are stacked into a single rectangle.
+
+    When offsetx == 0 or offsety == 0, the mirrored pixels land on the center
+    column or row and are skipped
     */
 
     int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
@@ -24,31 +32,24 @@ static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, ui
     int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
     int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
 
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-    } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
+    if (filled) {
+        if (!qp_internal_span_batch_push(device, &spans[0], ymy, xmx, xpx)) {
             return false;
         }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
+        if (offsety > 0 && !qp_internal_span_batch_push(device, &spans[1], ypy, xmx, xpx)) {
             return false;
         }
     } else {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
+        if (!qp_internal_span_batch_push(device, &spans[0], ymy, xmx, xmx)) {
             return false;
         }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
+        if (offsety > 0 && !qp_internal_span_batch_push(device, &spans[1], ypy, xmx, xmx)) {
             return false;
         }
-        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
+        if (offsetx > 0 && !qp_internal_span_batch_push(device, &spans[2], ymy, xpx, xpx)) {
             return false;
         }
-        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
+        if (offsetx > 0 && offsety > 0 && !qp_internal_span_batch_push(device, &spans[3], ypy, xpx, xpx)) {
             return false;
         }
     }
@@ -75,16 +76,19 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     int16_t dx = 0;
     int16_t dy = ((int16_t)sizey);
 
-    qp_internal_fill_pixdata(device, QP_MAX(sizex, sizey), hue, sat, val);
+    // Batched spans may be sent as rectangles several rows tall
+    qp_internal_fill_pixdata(device, (uint32_t)((sizex * 2) + 1) * ((sizey * 2) + 1), hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_ellipse: fail (could not start comms)\n");
         return false;
     }
 
+    qp_internal_span_batch_t spans[QP_ELLIPSE_SPAN_BATCHES] = {0};
+
     bool ret = true;
     for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
+        if (!qp_ellipse_helper_impl(device, spans, x, y, dx, dy, filled)) {
             ret = false;
             break;
         }
@@ -98,8 +102,8 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     dx = sizex;
     dy = 0;
 
-    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); ret && aa * dy <= bb * dx; dy++) {
+        if (!qp_ellipse_helper_impl(device, spans, x, y, dx, dy, filled)) {
             ret = false;
             break;
         }
@@ -110,6 +114,12 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
         delta += aa * (4 * dy + 6);
     }
 
+    for (uint8_t i = 0; ret && i < QP_ELLIPSE_SPAN_BATCHES; ++i) {
+        if (!qp_internal_span_batch_flush(device, &spans[i])) {
+            ret = false;
+        }
+    }
+
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
@@ -6,6 +6,7 @@
 #include "qp_comms.h"
 #include "qgf.h"
 #include "deferred_exec.h"
+#include "timer.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QGF image handles
@@ -19,6 +20,9 @@ typedef struct qgf_image_handle_t {
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
     };
 } qgf_image_handle_t;
 
@@ -85,6 +89,36 @@ painter_image_handle_t qp_load_image_mem(const void *buffer) {
     return qp_load_image_internal(image_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_flash
+
+static inline bool image_flash_stream_factory(qgf_image_handle_t *image, void *arg) {
+    const char *name = (const char *)arg;
+    uint32_t    address, length;
+    if (!qp_flash_assets_find(name, &address, &length)) {
+        return false;
+    }
+
+    // The QGF must fit within the directory entry, and the stream is trimmed to match so read-ahead stops at its end
+    image->flash_stream = qp_make_flash_stream(address, length);
+    uint32_t total_size  = qgf_get_total_size(&image->stream);
+    if (total_size == 0 || total_size > length) {
+        qp_dprintf("qp_load_image_flash: fail (asset '%s' is truncated)\n", name);
+        return false;
+    }
+    image->flash_stream.length = total_size;
+
+    return true;
+}
+
+painter_image_handle_t qp_load_image_flash(const char *name) {
+    return qp_load_image_internal(image_flash_stream_factory, (void *)name);
+}
+
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_image
 
@@ -117,10 +151,8 @@ typedef struct qgf_frame_info_t {
     bool                  has_palette;
     bool                  is_panel_native;
     bool                  is_delta;
-    uint16_t              left;
-    uint16_t              top;
-    uint16_t              right;
-    uint16_t              bottom;
+    uint8_t               rect_count;
+    qgf_delta_rect_v1_t   rects[QGF_MAX_DELTA_RECTS];
     uint16_t              delay;
 } qgf_frame_info_t;
 
@@ -148,53 +180,49 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
-    // Ensure we aren't reusing any palette
-    qp_internal_invalidate_palette();
-
     if (!qp_internal_bpp_capable(info->bpp)) {
         qp_dprintf("qp_drawimage_recolor: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)info->bpp);
-        qp_comms_stop(device);
         return false;
     }
 
     // Handle palette if needed
-    const uint16_t palette_entries  = 1u << info->bpp;
-    bool           needs_pixconvert = false;
+    const uint16_t palette_entries = 1u << info->bpp;
     if (info->has_palette) {
         // Load the palette from the stream
         if (!qp_internal_load_qgf_palette((qp_stream_t *)&qgf_image->stream, info->bpp)) {
             return false;
         }
 
-        needs_pixconvert = true;
-    } else {
-        if (info->bpp <= 8) {
-            // Interpolate from fg/bg
-            needs_pixconvert = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
-        }
-    }
-
-    if (needs_pixconvert) {
         // Convert the palette to native format
         if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
             qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
-            qp_comms_stop(device);
+            return false;
+        }
+    } else if (info->bpp <= 8) {
+        // Interpolate from fg/bg, reusing any previously converted palette
+        if (!qp_internal_prepare_recolor_palette(device, fg_hsv888, bg_hsv888, palette_entries)) {
+            qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
             return false;
         }
     }
 
-    // Handle delta if needed
+    // Handle delta if needed, otherwise the whole image is drawn
     if (info->is_delta) {
-        qgf_delta_v1_t delta_descriptor;
-        if (qp_stream_read(&delta_descriptor, sizeof(qgf_delta_v1_t), 1, &qgf_image->stream) != 1) {
-            qp_dprintf("Failed to read delta_descriptor, expected length was not %d\n", (int)sizeof(qgf_delta_v1_t));
+        qgf_block_header_v1_t delta_header;
+        if (qp_stream_read(&delta_header, sizeof(qgf_block_header_v1_t), 1, &qgf_image->stream) != 1) {
+            qp_dprintf("Failed to read delta_descriptor, expected length was not %d\n", (int)sizeof(qgf_block_header_v1_t));
             return false;
         }
 
-        info->left   = delta_descriptor.left;
-        info->top    = delta_descriptor.top;
-        info->right  = delta_descriptor.right;
-        info->bottom = delta_descriptor.bottom;
+        // The stream has already been validated, so the rectangle count is sane
+        info->rect_count = delta_header.length / sizeof(qgf_delta_rect_v1_t);
+        if (qp_stream_read(info->rects, sizeof(qgf_delta_rect_v1_t), info->rect_count, &qgf_image->stream) != info->rect_count) {
+            qp_dprintf("Failed to read delta rectangles, expected count was not %d\n", (int)info->rect_count);
+            return false;
+        }
+    } else {
+        info->rect_count = 1;
+        info->rects[0]   = (qgf_delta_rect_v1_t){.left = 0, .top = 0, .right = qgf_image->base.width - 1, .bottom = qgf_image->base.height - 1};
     }
 
     // Read the data block
@@ -208,8 +236,45 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     return true;
 }
 
-static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
-    qp_dprintf("qp_drawimage_recolor: entry\n");
+// Renders the requested frame, one viewport per dirty rectangle. Expects comms to already be started.
+static bool qp_drawimage_render_frame(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    painter_driver_t *  driver    = (painter_driver_t *)device;
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)image;
+
+    // Read the frame info
+    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
+        qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
+        return false;
+    }
+
+    // Set up the input state, shared by all the rectangles as they're compressed as a single block
+    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
+    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
+    if (input_callback == NULL) {
+        qp_dprintf("qp_drawimage_recolor: fail (invalid image compression scheme)\n");
+        return false;
+    }
+
+    for (uint8_t i = 0; i < frame_info->rect_count; ++i) {
+        const qgf_delta_rect_v1_t *rect = &frame_info->rects[i];
+
+        // Configure where we're going to be rendering to
+        if (!driver->driver_vtable->viewport(device, x + rect->left, y + rect->top, x + rect->right, y + rect->bottom)) {
+            qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
+            return false;
+        }
+
+        // Decode and stream pixels
+        uint32_t pixel_count = ((uint32_t)(rect->right - rect->left + 1)) * (rect->bottom - rect->top + 1);
+        if (!qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool qp_drawimage_validate(painter_device_t device, painter_image_handle_t image) {
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
         qp_dprintf("qp_drawimage_recolor: fail (validation_ok == false)\n");
@@ -222,9 +287,12 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    // Read the frame info
-    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
+    return true;
+}
+
+static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    qp_dprintf("qp_drawimage_recolor: entry\n");
+    if (!qp_drawimage_validate(device, image)) {
         return false;
     }
 
@@ -233,38 +301,7 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    uint16_t l, t, r, b;
-    if (frame_info->is_delta) {
-        l = x + frame_info->left;
-        t = y + frame_info->top;
-        r = x + frame_info->right;
-        b = y + frame_info->bottom;
-    } else {
-        l = x;
-        t = y;
-        r = x + image->width - 1;
-        b = y + image->height - 1;
-    }
-    uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
-
-    // Configure where we're going to be rendering to
-    if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
-        qp_comms_stop(device);
-        return false;
-    }
-
-    // Set up the input state
-    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
-    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
-    if (input_callback == NULL) {
-        qp_dprintf("qp_drawimage_recolor: fail (invalid image compression scheme)\n");
-        qp_comms_stop(device);
-        return false;
-    }
-
-    // Decode and stream pixels
-    bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+    bool ret = qp_drawimage_render_frame(device, x, y, image, frame_number, frame_info, fg_hsv888, bg_hsv888);
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -302,16 +339,70 @@ typedef struct animation_state_t {
 static deferred_executor_t animation_executors[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
 static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS]    = {0};
 
-static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
+// Consecutive frames due on the same device within an animation tick share a single comms transaction. Only one device
+// has its comms started at a time, as displays may well share a bus with each other.
+static bool                      animation_tick_active     = false;
+static painter_device_t          animation_tick_device     = NULL;
+static qp_animation_tick_stats_t animation_tick_stats      = {0};
+static qp_animation_tick_stats_t animation_last_tick_stats = {0};
+
+static void qp_animation_tick_release(void) {
+    if (animation_tick_device) {
+        qp_comms_stop(animation_tick_device);
+        animation_tick_device = NULL;
+    }
+}
+
+static bool qp_animation_comms_start(painter_device_t device) {
+    if (!animation_tick_active) {
+        return qp_comms_start(device);
+    }
+
+    if (animation_tick_device == device) {
+        return true;
+    }
+
+    // Let go of the previous device before starting on another
+    qp_animation_tick_release();
+    if (!qp_comms_start(device)) {
+        return false;
+    }
+    animation_tick_device = device;
+    ++animation_tick_stats.transactions;
+    return true;
+}
+
+static void qp_animation_comms_stop(painter_device_t device) {
+    // During a tick, comms are left running in case the next frame is for the same device
+    if (!animation_tick_active) {
+        qp_comms_stop(device);
+    }
+}
+
+static bool qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
     qgf_frame_info_t frame_info = {0};
     qp_dprintf("qp_render_animation_state: entry (frame #%d)\n", (int)state->frame_number);
-    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
+    if (!qp_drawimage_validate(state->device, state->image) || !qp_animation_comms_start(state->device)) {
+        qp_dprintf("qp_render_animation_state: fail (could not start comms)\n");
+        return false;
+    }
+
+    bool ret = qp_drawimage_render_frame(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
+    qp_animation_comms_stop(state->device);
     if (ret) {
         ++state->frame_number;
         if (state->frame_number >= state->image->frame_count) {
             state->frame_number = 0;
         }
         *delay_ms = frame_info.delay;
+
+        // Keep track of what this frame cost
+        ++animation_tick_stats.frames;
+        for (uint8_t i = 0; i < frame_info.rect_count; ++i) {
+            const qgf_delta_rect_v1_t *rect = &frame_info.rects[i];
+            animation_tick_stats.pixels += ((uint32_t)(rect->right - rect->left + 1)) * (rect->bottom - rect->top + 1);
+        }
+        animation_tick_stats.rects += frame_info.rect_count;
     }
     qp_dprintf("qp_render_animation_state: %s (delay %dms)\n", ret ? "ok" : "fail", (int)(*delay_ms));
     return ret;
@@ -392,5 +483,25 @@ void qp_stop_animation(deferred_token anim_token) {
 
 void qp_internal_animation_tick(void) {
     static uint32_t last_anim_exec = 0;
+    uint32_t        start          = timer_read32();
+
+    // Render every frame that's due, leaving comms running between frames for the same device
+    memset(&animation_tick_stats, 0, sizeof(animation_tick_stats));
+    animation_tick_active = true;
     deferred_exec_advanced_task(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, &last_anim_exec);
+    animation_tick_active = false;
+    qp_animation_tick_release();
+
+    if (animation_tick_stats.frames > 0) {
+        animation_tick_stats.elapsed = timer_elapsed32(start);
+        animation_last_tick_stats    = animation_tick_stats;
+        qp_dprintf("qp_internal_animation_tick: %d frames in %d transactions, %d rects, %d pixels, %dms\n", (int)animation_tick_stats.frames, (int)animation_tick_stats.transactions, (int)animation_tick_stats.rects, (int)animation_tick_stats.pixels, (int)animation_tick_stats.elapsed);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_get_animation_tick_stats
+
+qp_animation_tick_stats_t qp_get_animation_tick_stats(void) {
+    return animation_last_tick_stats;
 }
@@ -27,6 +27,9 @@ typedef struct qff_font_handle_t {
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
     };
 #if QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
     bool  owns_buffer;
@@ -36,6 +39,45 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+#    if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 255
+#        error QUANTUM_PAINTER_GLYPH_CACHE_SIZE must be no larger than 255
+#    endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Decoded glyph cache
+
+// Maximum number of glyphs composed into a single viewport by the span renderer
+#    define QP_GLYPH_SPAN_MAX_GLYPHS 32
+
+// Number of palette indices unpacked at a time before being handed to the driver
+#    define QP_GLYPH_SPAN_BATCH_PIXELS 32
+
+// Glyphs are kept as decompressed, still-packed palette indices -- the palette is applied while streaming, so entries
+// remain valid regardless of the colors or palette the font is drawn with.
+typedef struct qp_glyph_cache_entry_t {
+    qff_font_handle_t *font; // NULL if unused
+    uint32_t           code_point;
+    uint16_t           last_used;
+    uint8_t            width;
+    uint8_t            data[QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES];
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_SIZE] = {0};
+static uint16_t               glyph_cache_stamp                             = 0;
+
+// Drops all cached glyphs belonging to the supplied font
+static void qp_glyph_cache_invalidate(qff_font_handle_t *qff_font) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].font = NULL;
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -73,21 +115,25 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
     font->owns_buffer = false;
     font->buffer      = NULL;
 
-    void *ram_buffer = malloc(font->mem_stream.length);
+    // Works out the length from the font itself, as the stream may not be a memory stream
+    uint32_t font_length = qff_get_total_size(&font->stream);
+    void *   ram_buffer  = malloc(font_length);
     if (ram_buffer == NULL) {
         qp_dprintf("qp_load_font: could not allocate enough RAM for font, falling back to original\n");
     } else {
         do {
             // Copy the data into RAM
-            if (qp_stream_read(ram_buffer, 1, font->mem_stream.length, &font->mem_stream) != font->mem_stream.length) {
+            qp_stream_setpos(&font->stream, 0);
+            if (qp_stream_read(ram_buffer, 1, font_length, &font->stream) != font_length) {
                 qp_dprintf("qp_load_font: could not copy from flash to RAM, falling back to original\n");
                 break;
             }
 
-            // Create the new stream with the new buffer
+            // Create the new stream with the new buffer, closing the original
+            qp_stream_close(&font->stream);
             font->buffer      = ram_buffer;
             font->owns_buffer = true;
-            font->mem_stream  = qp_make_memory_stream(font->buffer, font->mem_stream.length);
+            font->mem_stream  = qp_make_memory_stream(font->buffer, font_length);
         } while (0);
     }
 
@@ -132,6 +178,36 @@ painter_font_handle_t qp_load_font_mem(const void *buffer) {
     return qp_load_font_internal(font_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_font_flash
+
+static inline bool font_flash_stream_factory(qff_font_handle_t *font, void *arg) {
+    const char *name = (const char *)arg;
+    uint32_t    address, length;
+    if (!qp_flash_assets_find(name, &address, &length)) {
+        return false;
+    }
+
+    // The QFF must fit within the directory entry, and the stream is trimmed to match so read-ahead stops at its end
+    font->flash_stream = qp_make_flash_stream(address, length);
+    uint32_t total_size  = qff_get_total_size(&font->stream);
+    if (total_size == 0 || total_size > length) {
+        qp_dprintf("qp_load_font_flash: fail (asset '%s' is truncated)\n", name);
+        return false;
+    }
+    font->flash_stream.length = total_size;
+
+    return true;
+}
+
+painter_font_handle_t qp_load_font_flash(const char *name) {
+    return qp_load_font_internal(font_flash_stream_factory, (void *)name);
+}
+
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_font
 
@@ -151,6 +227,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Any cached glyphs are no longer valid
+    qp_glyph_cache_invalidate(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -183,8 +264,7 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     }
 
     // Handle palette if needed
-    const uint16_t palette_entries  = 1u << qff_font->bpp;
-    bool           needs_pixconvert = false;
+    const uint16_t palette_entries = 1u << qff_font->bpp;
     if (qff_font->has_palette) {
         // If this font has a palette, we need to read it out and set up the pixel lookup table
         qp_stream_setpos(&qff_font->stream, offset);
@@ -194,20 +274,20 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
 
         // Skip this block, as far as offset calculations go
         offset += sizeof(qgf_palette_v1_t) + (palette_entries * 3);
-        needs_pixconvert = true;
-    } else {
-        // Interpolate from fg/bg
-        int16_t palette_entries = 1 << qff_font->bpp;
-        needs_pixconvert        = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
-    }
 
-    if (needs_pixconvert) {
         // Convert the palette to native format
         if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
             qp_dprintf("qp_drawtext_recolor: fail (could not convert pixels to native)\n");
             qp_comms_stop(device);
             return false;
         }
+    } else {
+        // Interpolate from fg/bg, reusing any previously converted palette
+        if (!qp_internal_prepare_recolor_palette(device, fg_hsv888, bg_hsv888, palette_entries)) {
+            qp_dprintf("qp_drawtext_recolor: fail (could not convert pixels to native)\n");
+            qp_comms_stop(device);
+            return false;
+        }
     }
 
     *data_offset = offset;
@@ -292,9 +372,9 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
     return false;
 }
 
-// Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
-static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
-    while (*str) {
+// Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph. Stops at `end` if non-NULL.
+static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, const char *end, code_point_handler handler, void *cb_arg) {
+    while ((!end || str < end) && *str) {
         int32_t code_point = 0;
         str                = decode_utf8(str, &code_point);
         if (code_point < 0) {
@@ -369,6 +449,311 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Span rendering from the decoded glyph cache
+
+// Finds the cached glyph, or decodes it into the least-recently-used slot not already referenced by the current span.
+// Returns NULL without setting `failed` if the glyph can't be cached right now, so the caller can fall back.
+static qp_glyph_cache_entry_t *qp_glyph_cache_fetch(code_point_iter_drawglyph_state_t *state, qff_font_handle_t *qff_font, uint32_t code_point, bool *failed) {
+    qp_glyph_cache_entry_t *victim = NULL;
+    *failed                        = false;
+
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->font == qff_font && entry->code_point == code_point) {
+            entry->last_used = glyph_cache_stamp;
+            return entry;
+        }
+
+        // Prefer unused slots, then the oldest one that isn't pinned by the current span
+        if (!entry->font) {
+            if (!victim || victim->font) {
+                victim = entry;
+            }
+        } else if (entry->last_used != glyph_cache_stamp && (!victim || (victim->font && (uint16_t)(glyph_cache_stamp - entry->last_used) > (uint16_t)(glyph_cache_stamp - victim->last_used)))) {
+            victim = entry;
+        }
+    }
+
+    // Native-format fonts are streamed as-is
+    if (!victim || qff_font->bpp > 8) {
+        return NULL;
+    }
+
+    uint8_t width;
+    if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        *failed = true;
+        return NULL;
+    }
+
+    uint32_t byte_count = (((uint32_t)width) * qff_font->base.line_height * qff_font->bpp + 7) / 8;
+    if (byte_count > QUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES) {
+        return NULL;
+    }
+
+    // Decompress the glyph into the cache -- the stream is already positioned by qp_drawtext_prepare_glyph_for_render()
+    victim->font                 = NULL;
+    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
+    for (uint32_t i = 0; i < byte_count; ++i) {
+        int16_t byteval = state->input_callback(state->input_state);
+        if (byteval < 0) {
+            *failed = true;
+            return NULL;
+        }
+        victim->data[i] = (uint8_t)byteval;
+    }
+
+    victim->font       = qff_font;
+    victim->code_point = code_point;
+    victim->width      = width;
+    victim->last_used  = glyph_cache_stamp;
+    return victim;
+}
+
+// Hands a batch of palette indices to the driver, transmitting the pixdata buffer whenever it fills up
+static bool qp_glyph_span_append(qp_internal_pixel_output_state_t *output_state, uint8_t *indices, uint32_t count) {
+    painter_driver_t *driver = (painter_driver_t *)output_state->device;
+    while (count > 0) {
+        uint32_t chunk = QP_MIN(count, output_state->max_pixels - output_state->pixel_write_pos);
+        if (!driver->driver_vtable->append_pixels(output_state->device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, output_state->pixel_write_pos, chunk, indices)) {
+            return false;
+        }
+        output_state->pixel_write_pos += chunk;
+        indices += chunk;
+        count -= chunk;
+
+        if (output_state->pixel_write_pos == output_state->max_pixels) {
+            if (!driver->driver_vtable->pixdata(output_state->device, qp_internal_global_pixdata_buffer, output_state->pixel_write_pos)) {
+                return false;
+            }
+            qp_internal_swap_pixdata_buffer();
+            output_state->pixel_write_pos = 0;
+        }
+    }
+    return true;
+}
+
+// Streams the supplied cached glyphs side-by-side through a single viewport, row by row
+static bool qp_glyph_span_emit(code_point_iter_drawglyph_state_t *state, qff_font_handle_t *qff_font, const uint8_t *slots, uint8_t slot_count, int16_t span_width) {
+    painter_driver_t *driver = (painter_driver_t *)state->device;
+    if (span_width == 0) {
+        return true;
+    }
+
+    const uint8_t height = qff_font->base.line_height;
+    const uint8_t bpp    = qff_font->bpp;
+    const uint8_t mask   = (1 << bpp) - 1;
+
+    driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + span_width - 1, state->ypos + height - 1);
+    state->xpos += span_width;
+
+    qp_internal_pixel_output_state_t *output_state = state->output_state;
+    output_state->pixel_write_pos                  = 0;
+
+    uint8_t batch[QP_GLYPH_SPAN_BATCH_PIXELS];
+    uint8_t batch_count = 0;
+    for (uint8_t row = 0; row < height; ++row) {
+        for (uint8_t k = 0; k < slot_count; ++k) {
+            const qp_glyph_cache_entry_t *entry = &glyph_cache[slots[k]];
+            uint32_t                      bit   = ((uint32_t)row) * entry->width * bpp;
+            for (uint8_t col = 0; col < entry->width; ++col, bit += bpp) {
+                batch[batch_count++] = (entry->data[bit >> 3] >> (bit & 7)) & mask;
+                if (batch_count == QP_GLYPH_SPAN_BATCH_PIXELS) {
+                    if (!qp_glyph_span_append(output_state, batch, batch_count)) {
+                        return false;
+                    }
+                    batch_count = 0;
+                }
+            }
+        }
+    }
+
+    if (batch_count > 0 && !qp_glyph_span_append(output_state, batch, batch_count)) {
+        return false;
+    }
+
+    // Any leftovers need transmission as well.
+    if (output_state->pixel_write_pos > 0) {
+        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, output_state->pixel_write_pos)) {
+            return false;
+        }
+        qp_internal_swap_pixdata_buffer();
+        output_state->pixel_write_pos = 0;
+    }
+
+    return true;
+}
+
+// Draws the string by collecting runs of cached glyphs into spans, falling back to per-glyph rendering for anything uncacheable
+static bool qp_drawtext_render(code_point_iter_drawglyph_state_t *state, qff_font_handle_t *qff_font, const char *str, const char *end) {
+    while ((!end || str < end) && *str) {
+        uint8_t slots[QP_GLYPH_SPAN_MAX_GLYPHS];
+        uint8_t slot_count = 0;
+        int16_t span_width = 0;
+
+        // Anything fetched for this span is pinned until it has been emitted
+        ++glyph_cache_stamp;
+
+        while ((!end || str < end) && *str && slot_count < QP_GLYPH_SPAN_MAX_GLYPHS) {
+            int32_t     code_point = 0;
+            const char *next       = decode_utf8(str, &code_point);
+            if (code_point < 0) {
+                qp_dprintf("Invalid unicode code point decoded. Cannot render.\n");
+                return false;
+            }
+
+            bool                    failed;
+            qp_glyph_cache_entry_t *entry = qp_glyph_cache_fetch(state, qff_font, code_point, &failed);
+            if (failed) {
+                qp_dprintf("Failed to decode glyph into the cache.\n");
+                return false;
+            }
+
+            if (!entry) {
+                // Out of unpinned slots, emit what we have and try again with a fresh span
+                if (slot_count > 0) {
+                    break;
+                }
+
+                // Not cacheable at all, render it directly
+                if (!qp_iterate_code_points(qff_font, str, next, qp_font_code_point_handler_drawglyph, state)) {
+                    return false;
+                }
+                str = next;
+                break;
+            }
+
+            slots[slot_count++] = (uint8_t)(entry - glyph_cache);
+            span_width += entry->width;
+            str = next;
+        }
+
+        if (!qp_glyph_span_emit(state, qff_font, slots, slot_count, span_width)) {
+            qp_dprintf("Failed to emit glyph span.\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+// Retrieves the width of a glyph, from the cache if available
+static bool qp_drawtext_glyph_width(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        if (glyph_cache[i].font == qff_font && glyph_cache[i].code_point == code_point) {
+            *width = glyph_cache[i].width;
+            return true;
+        }
+    }
+    return qp_drawtext_prepare_glyph_for_render(qff_font, code_point, width);
+}
+
+#else // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+static inline bool qp_drawtext_render(code_point_iter_drawglyph_state_t *state, qff_font_handle_t *qff_font, const char *str, const char *end) {
+    return qp_iterate_code_points(qff_font, str, end, qp_font_code_point_handler_drawglyph, state);
+}
+
+static inline bool qp_drawtext_glyph_width(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+    return qp_drawtext_prepare_glyph_for_render(qff_font, code_point, width);
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// String diffing
+
+// Advances over the next glyph of the string, returning NULL on failure
+static const char *qp_drawtext_next_glyph(qff_font_handle_t *qff_font, const char *str, int32_t *code_point, uint8_t *width) {
+    str = decode_utf8(str, code_point);
+    if (*code_point < 0) {
+        qp_dprintf("Invalid unicode code point decoded. Cannot render.\n");
+        return NULL;
+    }
+    if (!qp_drawtext_glyph_width(qff_font, *code_point, width)) {
+        qp_dprintf("Failed to prepare glyph for rendering.\n");
+        return NULL;
+    }
+    return str;
+}
+
+// Redraws only the glyphs of `str` which differ from the glyph previously drawn at the same position in `prev`.
+// The width of the previous string is returned in `prev_width`, so that any leftover glyphs can be cleared.
+static bool qp_drawtext_diff(code_point_iter_drawglyph_state_t *state, qff_font_handle_t *qff_font, const char *prev, const char *str, int16_t *prev_width) {
+    const int16_t x        = state->xpos;
+    int16_t       xpos     = 0;
+    int16_t       old_xpos = 0;
+    const char *  run      = NULL;
+    int16_t       run_xpos = 0;
+
+    while (*str) {
+        int32_t     code_point;
+        uint8_t     width;
+        const char *next = qp_drawtext_next_glyph(qff_font, str, &code_point, &width);
+        if (!next) {
+            return false;
+        }
+
+        // Skip over any previous glyphs which started before this one
+        int32_t old_code_point = -1;
+        while (*prev && old_xpos <= xpos) {
+            int32_t     cp;
+            uint8_t     old_width;
+            const char *old_next = qp_drawtext_next_glyph(qff_font, prev, &cp, &old_width);
+            if (!old_next) {
+                return false;
+            }
+            if (old_xpos == xpos) {
+                old_code_point = cp;
+            }
+            old_xpos += old_width;
+            prev = old_next;
+            if (old_code_point >= 0) {
+                break;
+            }
+        }
+
+        // Glyphs are unchanged if the previous string had the same code point at the same position
+        bool unchanged = old_code_point == code_point;
+        if (unchanged && run) {
+            state->xpos = x + run_xpos;
+            if (!qp_drawtext_render(state, qff_font, run, str)) {
+                return false;
+            }
+            run = NULL;
+        } else if (!unchanged && !run) {
+            run      = str;
+            run_xpos = xpos;
+        }
+
+        xpos += width;
+        str = next;
+    }
+
+    if (run) {
+        state->xpos = x + run_xpos;
+        if (!qp_drawtext_render(state, qff_font, run, NULL)) {
+            return false;
+        }
+    }
+
+    // Work out how far the previous string extended
+    while (*prev) {
+        int32_t cp;
+        uint8_t old_width;
+        prev = qp_drawtext_next_glyph(qff_font, prev, &cp, &old_width);
+        if (!prev) {
+            return false;
+        }
+        old_xpos += old_width;
+    }
+
+    state->xpos = x + xpos;
+    *prev_width = old_xpos;
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_textwidth
 
@@ -382,7 +767,7 @@ int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
     // Create the codepoint iterator state
     code_point_iter_calcwidth_state_t state = {.width = 0};
     // Iterate each codepoint, return the calculated width if successful.
-    return qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
+    return qp_iterate_code_points(qff_font, str, NULL, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -398,21 +783,37 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
 // Quantum Painter External API: qp_drawtext_recolor
 
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
-    qp_dprintf("qp_drawtext_recolor: entry\n");
+    // Offload to the update variant, with nothing previously drawn.
+    return qp_drawtext_update_recolor(device, x, y, font, NULL, str, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_update
+
+int16_t qp_drawtext_update(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *prev, const char *str) {
+    // Offload to the recolor variant, substituting fg=white bg=black.
+    return qp_drawtext_update_recolor(device, x, y, font, prev, str, 0, 0, 255, 0, 0, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_update_recolor
+
+int16_t qp_drawtext_update_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *prev, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_dprintf("qp_drawtext_update_recolor: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
-        qp_dprintf("qp_drawtext_recolor: fail (validation_ok == false)\n");
+        qp_dprintf("qp_drawtext_update_recolor: fail (validation_ok == false)\n");
         return 0;
     }
 
     qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
     if (!qff_font || !qff_font->validate_ok) {
-        qp_dprintf("qp_drawtext_recolor: fail (invalid font)\n");
+        qp_dprintf("qp_drawtext_update_recolor: fail (invalid font)\n");
         return false;
     }
 
     if (!qp_comms_start(device)) {
-        qp_dprintf("qp_drawtext_recolor: fail (could not start comms)\n");
+        qp_dprintf("qp_drawtext_update_recolor: fail (could not start comms)\n");
         return 0;
     }
 
@@ -420,7 +821,7 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qff_font->stream};
     qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme);
     if (input_callback == NULL) {
-        qp_dprintf("qp_drawtext_recolor: fail (invalid font compression scheme)\n");
+        qp_dprintf("qp_drawtext_update_recolor: fail (invalid font compression scheme)\n");
         qp_comms_stop(device);
         return false;
     }
@@ -443,15 +844,29 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
     uint32_t   data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
-        qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
+        qp_dprintf("qp_drawtext_update_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
         return false;
     }
 
-    // Iterate the codepoints with the drawglyph callback
-    bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
+    bool ret;
+    if (prev == NULL) {
+        // Nothing drawn previously, render every glyph
+        ret = qp_drawtext_render(&state, qff_font, str, NULL);
+    } else {
+        // Only render the glyphs that changed
+        int16_t prev_width = 0;
+        ret                = qp_drawtext_diff(&state, qff_font, prev, str, &prev_width);
+
+        // Clear out whatever remains of the previous string past the end of the new one
+        int16_t width = state.xpos - x;
+        if (ret && prev_width > width) {
+            qp_internal_fill_pixdata(device, ((uint32_t)(prev_width - width)) * qff_font->base.line_height, hue_bg, sat_bg, val_bg);
+            ret = qp_internal_fillrect_helper_impl(device, x + width, y, x + prev_width - 1, y + qff_font->base.line_height - 1);
+        }
+    }
 
-    qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
+    qp_dprintf("qp_drawtext_update_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret ? (state.xpos - x) : 0;
 }
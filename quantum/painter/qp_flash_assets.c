@@ -0,0 +1,212 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "qp_internal.h"
+#include "qp_flash_assets.h"
+#include "flash.h"
+
+#ifdef FLASH_DRIVER_SPI
+#    include "flash_spi.h"
+#endif // FLASH_DRIVER_SPI
+
+#ifndef QUANTUM_PAINTER_FLASH_ASSETS_SECTOR_SIZE
+#    ifdef EXTERNAL_FLASH_SECTOR_SIZE
+#        define QUANTUM_PAINTER_FLASH_ASSETS_SECTOR_SIZE (EXTERNAL_FLASH_SECTOR_SIZE)
+#    else
+#        error "QUANTUM_PAINTER_FLASH_ASSETS_SECTOR_SIZE must be defined when not using the SPI flash driver"
+#    endif
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_SECTOR_SIZE
+
+#ifndef QUANTUM_PAINTER_FLASH_ASSETS_SIZE
+#    ifdef EXTERNAL_FLASH_SIZE
+#        define QUANTUM_PAINTER_FLASH_ASSETS_SIZE ((EXTERNAL_FLASH_SIZE) - (QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS))
+#    else
+#        error "QUANTUM_PAINTER_FLASH_ASSETS_SIZE must be defined when not using the SPI flash driver"
+#    endif
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_SIZE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asset directory format
+
+#define QP_FLASH_ASSETS_MAGIC 0x415051 // "QPA"
+#define QP_FLASH_ASSETS_VERSION 0x01
+#define QP_FLASH_ASSETS_NAME_LENGTH 16
+
+typedef struct QP_PACKED qp_flash_assets_header_v1_t {
+    uint32_t magic : 24;      // constant, equal to 0x415051 ("QPA")
+    uint8_t  version;         // constant, equal to 0x01
+    uint16_t entry_count;     // number of directory entries following the header
+    uint16_t neg_entry_count; // negated value of entry_count
+    uint32_t total_size;      // total size of the header, directory, and asset data
+    uint32_t neg_total_size;  // negated value of total_size
+} qp_flash_assets_header_v1_t;
+
+STATIC_ASSERT(sizeof(qp_flash_assets_header_v1_t) == 16, "qp_flash_assets_header_v1_t must be 16 bytes in v1 of the asset directory");
+
+typedef struct QP_PACKED qp_flash_assets_entry_v1_t {
+    char     name[QP_FLASH_ASSETS_NAME_LENGTH]; // NUL-padded, not terminated if all 16 characters are used
+    uint32_t offset;                             // offset of the asset's data, relative to the start of the header
+    uint32_t length;                             // length of the asset's data
+} qp_flash_assets_entry_v1_t;
+
+STATIC_ASSERT(sizeof(qp_flash_assets_entry_v1_t) == 24, "qp_flash_assets_entry_v1_t must be 24 bytes in v1 of the asset directory");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+static bool qp_flash_assets_initialised = false;
+
+static void qp_flash_assets_init(void) {
+    if (!qp_flash_assets_initialised) {
+        flash_init();
+        qp_flash_assets_initialised = true;
+    }
+}
+
+static bool qp_flash_assets_read_header(qp_flash_assets_header_v1_t *header) {
+    qp_flash_assets_init();
+    if (flash_read_range(QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS, header, sizeof(qp_flash_assets_header_v1_t)) != FLASH_STATUS_SUCCESS) {
+        qp_dprintf("qp_flash_assets: fail (could not read directory header)\n");
+        return false;
+    }
+
+    if (header->magic != QP_FLASH_ASSETS_MAGIC || header->version != QP_FLASH_ASSETS_VERSION) {
+        qp_dprintf("qp_flash_assets: fail (no asset directory present)\n");
+        return false;
+    }
+
+    if (header->entry_count != ((~header->neg_entry_count) & 0xFFFF) || header->total_size != ~header->neg_total_size) {
+        qp_dprintf("qp_flash_assets: fail (corrupt directory header)\n");
+        return false;
+    }
+
+    if (header->total_size > QUANTUM_PAINTER_FLASH_ASSETS_SIZE || sizeof(qp_flash_assets_header_v1_t) + ((uint32_t)header->entry_count) * sizeof(qp_flash_assets_entry_v1_t) > header->total_size) {
+        qp_dprintf("qp_flash_assets: fail (directory larger than flash region)\n");
+        return false;
+    }
+
+    return true;
+}
+
+static inline uint32_t qp_flash_assets_get_u32(const uint8_t *data) {
+    return ((uint32_t)data[0]) | (((uint32_t)data[1]) << 8) | (((uint32_t)data[2]) << 16) | (((uint32_t)data[3]) << 24);
+}
+
+static inline void qp_flash_assets_put_u32(uint8_t *data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_flash_assets_find
+
+bool qp_flash_assets_find(const char *name, uint32_t *address, uint32_t *length) {
+    qp_flash_assets_header_v1_t header;
+    if (!name || strlen(name) > QP_FLASH_ASSETS_NAME_LENGTH || !qp_flash_assets_read_header(&header)) {
+        return false;
+    }
+
+    uint32_t entry_address = QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS + sizeof(qp_flash_assets_header_v1_t);
+    for (uint16_t i = 0; i < header.entry_count; ++i, entry_address += sizeof(qp_flash_assets_entry_v1_t)) {
+        qp_flash_assets_entry_v1_t entry;
+        if (flash_read_range(entry_address, &entry, sizeof(qp_flash_assets_entry_v1_t)) != FLASH_STATUS_SUCCESS) {
+            qp_dprintf("qp_flash_assets_find: fail (could not read directory entry %d)\n", (int)i);
+            return false;
+        }
+
+        if (strncmp(name, entry.name, QP_FLASH_ASSETS_NAME_LENGTH) != 0) {
+            continue;
+        }
+
+        if (entry.offset > header.total_size || entry.length > header.total_size - entry.offset) {
+            qp_dprintf("qp_flash_assets_find: fail (asset '%s' extends past the end of the directory)\n", name);
+            return false;
+        }
+
+        *address = QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS + entry.offset;
+        *length  = entry.length;
+        return true;
+    }
+
+    qp_dprintf("qp_flash_assets_find: fail (asset '%s' not found)\n", name);
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_flash_assets_raw_hid_receive
+
+__attribute__((weak)) void qp_flash_assets_updated_user(void) {}
+
+__attribute__((weak)) void qp_flash_assets_updated_kb(void) {
+    qp_flash_assets_updated_user();
+}
+
+bool qp_flash_assets_raw_hid_receive(uint8_t *data, uint8_t length) {
+    // Raw HID reports are a fixed size, which always fits the largest header and response
+    if (length < 11 || data[0] != QUANTUM_PAINTER_FLASH_ASSETS_RAW_HID_ID) {
+        return false;
+    }
+
+    qp_flash_assets_init();
+
+    uint8_t *      payload = &data[3];
+    uint8_t        max     = length - 3;
+    flash_status_t status  = FLASH_STATUS_SUCCESS;
+    switch (data[1]) {
+        case QP_FLASH_ASSETS_COMMAND_INFO: {
+            qp_flash_assets_put_u32(&payload[0], QUANTUM_PAINTER_FLASH_ASSETS_SIZE);
+            qp_flash_assets_put_u32(&payload[4], QUANTUM_PAINTER_FLASH_ASSETS_SECTOR_SIZE);
+            break;
+        }
+
+        case QP_FLASH_ASSETS_COMMAND_ERASE: {
+            uint32_t offset = qp_flash_assets_get_u32(&data[2]);
+            if (offset >= QUANTUM_PAINTER_FLASH_ASSETS_SIZE || (offset % QUANTUM_PAINTER_FLASH_ASSETS_SECTOR_SIZE) != 0) {
+                status = FLASH_STATUS_BAD_ADDRESS;
+                break;
+            }
+            status = flash_erase_sector(QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS + offset);
+            break;
+        }
+
+        case QP_FLASH_ASSETS_COMMAND_WRITE:
+        case QP_FLASH_ASSETS_COMMAND_READ: {
+            uint32_t offset = qp_flash_assets_get_u32(&data[2]);
+            uint8_t  count  = data[6];
+            bool     write  = data[1] == QP_FLASH_ASSETS_COMMAND_WRITE;
+            if (count > (write ? length - 7 : max) || offset > QUANTUM_PAINTER_FLASH_ASSETS_SIZE || count > QUANTUM_PAINTER_FLASH_ASSETS_SIZE - offset) {
+                status = FLASH_STATUS_BAD_ADDRESS;
+                break;
+            }
+            if (write) {
+                status = flash_write_range(QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS + offset, &data[7], count);
+            } else {
+                status = flash_read_range(QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS + offset, payload, count);
+            }
+            break;
+        }
+
+        case QP_FLASH_ASSETS_COMMAND_COMMIT: {
+            qp_flash_assets_header_v1_t header;
+            if (!qp_flash_assets_read_header(&header)) {
+                status = FLASH_STATUS_ERROR;
+                break;
+            }
+            payload[0] = header.entry_count & 0xFF;
+            payload[1] = (header.entry_count >> 8) & 0xFF;
+            qp_flash_assets_updated_kb();
+            break;
+        }
+
+        default:
+            status = FLASH_STATUS_ERROR;
+            break;
+    }
+
+    qp_dprintf("qp_flash_assets_raw_hid_receive: command %d %s\n", (int)data[1], status == FLASH_STATUS_SUCCESS ? "ok" : "fail");
+    data[2] = (uint8_t)status;
+    return true;
+}
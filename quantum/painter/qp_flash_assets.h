@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "qp.h"
+
+#ifndef QUANTUM_PAINTER_FLASH_ASSETS_RAW_HID_ID
+#    define QUANTUM_PAINTER_FLASH_ASSETS_RAW_HID_ID 0x51
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter - Flash assets raw HID protocol
+//
+// Every report starts with QUANTUM_PAINTER_FLASH_ASSETS_RAW_HID_ID, followed by one of the commands below. Responses
+// echo those two bytes, followed by a flash_status_t result, then any response payload. Offsets are relative to
+// QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS, and multi-byte values are little-endian.
+
+typedef enum qp_flash_assets_command_t {
+    QP_FLASH_ASSETS_COMMAND_INFO   = 0x01, // -> uint32_t region_size, uint32_t sector_size
+    QP_FLASH_ASSETS_COMMAND_ERASE  = 0x02, // uint32_t offset -> (erases the sector starting at offset)
+    QP_FLASH_ASSETS_COMMAND_WRITE  = 0x03, // uint32_t offset, uint8_t count, uint8_t data[count] ->
+    QP_FLASH_ASSETS_COMMAND_READ   = 0x04, // uint32_t offset, uint8_t count -> uint8_t data[count]
+    QP_FLASH_ASSETS_COMMAND_COMMIT = 0x05, // -> uint16_t entry_count (validates the directory, then notifies the keymap)
+} qp_flash_assets_command_t;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter - Flash assets External API
+
+/**
+ * Looks up an asset within the directory held in external flash.
+ *
+ * @param name[in] the name of the asset
+ * @param address[out] the absolute flash address of the asset's data
+ * @param length[out] the length of the asset's data, in bytes
+ * @return true if the asset was found
+ * @return false if the asset wasn't found, or the directory is invalid
+ */
+bool qp_flash_assets_find(const char *name, uint32_t *address, uint32_t *length);
+
+/**
+ * Handles any asset updater commands received over raw HID. Intended to be called from `raw_hid_receive()`, or from
+ * `raw_hid_receive_kb()` when VIA is enabled.
+ *
+ * @param data[in,out] the received report, overwritten with the response
+ * @param length[in] the length of the report
+ * @return true if the report was handled, and the response should be sent using `raw_hid_send()`
+ * @return false if the report was not an asset updater command
+ */
+bool qp_flash_assets_raw_hid_receive(uint8_t *data, uint8_t length);
+
+/**
+ * Invoked after the host has committed an updated asset directory. Any images or fonts loaded from flash should be
+ * closed and reloaded.
+ */
+void qp_flash_assets_updated_kb(void);
+void qp_flash_assets_updated_user(void);
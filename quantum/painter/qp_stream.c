@@ -3,6 +3,11 @@
 
 #include "qp_stream.h"
 
+#ifdef QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+#    include "flash.h"
+#    include "qp_comms.h"
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Stream API
 
@@ -164,3 +169,101 @@ qp_file_stream_t qp_make_file_stream(FILE *f) {
     return stream;
 }
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+
+static inline int16_t flash_get(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    if (s->position >= s->length) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    // Refill the cache starting at the current position, reading ahead as far as the cache allows
+    if (s->position < s->cache_position || s->position >= s->cache_position + s->cache_length) {
+        uint16_t count = (uint16_t)QP_MIN(s->length - s->position, (int32_t)sizeof(s->cache));
+
+        // Assets are read while drawing, so any display sharing the flash's bus has to let go of it for the duration
+        painter_device_t suspended = qp_comms_suspend();
+        flash_status_t   status    = flash_read_range(s->address + s->position, s->cache, count);
+        if (!qp_comms_resume(suspended)) {
+            status = FLASH_STATUS_ERROR;
+        }
+
+        if (status != FLASH_STATUS_SUCCESS) {
+            s->cache_length = 0;
+            s->is_eof       = true;
+            return STREAM_EOF;
+        }
+        s->cache_position = s->position;
+        s->cache_length   = count;
+    }
+
+    return s->cache[s->position++ - s->cache_position];
+}
+
+static inline bool flash_put(qp_stream_t *stream, uint8_t c) {
+    // Read-only, assets are written using the raw HID updater.
+    return false;
+}
+
+static inline int flash_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Handle as per fseek
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    // The cache is left intact, so seeking back within it (such as when rereading block headers) is free
+    s->position = position;
+    s->is_eof   = false;
+    return 0;
+}
+
+static inline int32_t flash_tell(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool flash_is_eof(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void flash_close(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    s->cache_length      = 0;
+}
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length) {
+    qp_flash_stream_t stream = {
+        .base           = {.get = flash_get, .put = flash_put, .seek = flash_seek, .tell = flash_tell, .is_eof = flash_is_eof, .close = flash_close},
+        .address        = address,
+        .length         = length,
+        .position       = 0,
+        .cache_position = 0,
+        .cache_length   = 0,
+    };
+    return stream;
+}
+
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
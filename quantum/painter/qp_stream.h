@@ -83,3 +83,23 @@ typedef struct qp_file_stream_t {
 qp_file_stream_t qp_make_file_stream(FILE *f);
 
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+
+typedef struct qp_flash_stream_t {
+    qp_stream_t base;
+    uint32_t    address;
+    int32_t     length;
+    int32_t     position;
+    bool        is_eof;
+    int32_t     cache_position; // stream position of the first cached byte
+    uint16_t    cache_length;   // number of valid bytes in the cache, or zero if empty
+    uint8_t     cache[QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE];
+} qp_flash_stream_t;
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length);
+
+#endif // QUANTUM_PAINTER_FLASH_ASSETS_ENABLE
@@ -1,6 +1,7 @@
 # Quantum Painter Configurables
 QUANTUM_PAINTER_DRIVERS ?=
 QUANTUM_PAINTER_ANIMATIONS_ENABLE ?= yes
+QUANTUM_PAINTER_FLASH_ASSETS_ENABLE ?= no
 
 QUANTUM_PAINTER_LVGL_INTEGRATION ?= no
 
@@ -49,6 +50,13 @@ ifeq ($(strip $(QUANTUM_PAINTER_ANIMATIONS_ENABLE)), yes)
     OPT_DEFS += -DQUANTUM_PAINTER_ANIMATIONS_ENABLE
 endif
 
+# Check if people want assets in external flash... enable the flash driver if so.
+ifeq ($(strip $(QUANTUM_PAINTER_FLASH_ASSETS_ENABLE)), yes)
+    FLASH_DRIVER ?= spi
+    OPT_DEFS += -DQUANTUM_PAINTER_FLASH_ASSETS_ENABLE
+    SRC += $(QUANTUM_DIR)/painter/qp_flash_assets.c
+endif
+
 # Comms flags
 QUANTUM_PAINTER_NEEDS_COMMS_DUMMY ?= no
 QUANTUM_PAINTER_NEEDS_COMMS_SPI ?= no
@@ -0,0 +1,667 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "qp_test_host.hpp"
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+extern "C" {
+#include "color.h"
+#include "qp_surface.h"
+}
+
+#define HOST_WIDTH 64
+#define HOST_HEIGHT 64
+#define IMAGE_WIDTH 24
+#define IMAGE_HEIGHT 20
+#define IMAGE_X 4
+#define IMAGE_Y 6
+#define SURFACE_WIDTH 32
+#define SURFACE_HEIGHT 32
+#define SURFACE_X 8
+#define SURFACE_Y 12
+#define LINE_HEIGHT 8
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Compressors, matching the decoders in qp_draw_codec.c
+
+static std::vector<uint8_t> rle_compress(const std::vector<uint8_t> &in) {
+    std::vector<uint8_t> out;
+    size_t               i = 0;
+    while (i < in.size()) {
+        size_t run = 1;
+        while (i + run < in.size() && run < 127 && in[i + run] == in[i]) {
+            ++run;
+        }
+        if (run >= 3) {
+            out.push_back(run);
+            out.push_back(in[i]);
+            i += run;
+            continue;
+        }
+
+        // Gather literals until the next run worth encoding
+        size_t start = i;
+        while (i < in.size() && i - start < 128 && !(i + 2 < in.size() && in[i] == in[i + 1] && in[i] == in[i + 2])) {
+            ++i;
+        }
+        out.push_back(127 + (i - start));
+        out.insert(out.end(), in.begin() + start, in.begin() + i);
+    }
+    return out;
+}
+
+static void lz_put_length(std::vector<uint8_t> &out, size_t length) {
+    if (length >= 15) {
+        for (length -= 15; length >= 255; length -= 255) {
+            out.push_back(255);
+        }
+        out.push_back(length);
+    }
+}
+
+static std::vector<uint8_t> lz_compress(const std::vector<uint8_t> &in) {
+    std::vector<uint8_t> out;
+    size_t               literals = 0, i = 0;
+    while (i < in.size()) {
+        // Greedy search for the longest match within the history window
+        size_t best_length = 0, best_distance = 0;
+        for (size_t distance = 1; distance <= 255 && distance <= i; ++distance) {
+            size_t length = 0;
+            while (i + length < in.size() && in[i + length] == in[i + length - distance]) {
+                ++length;
+            }
+            if (length > best_length) {
+                best_length   = length;
+                best_distance = distance;
+            }
+        }
+
+        if (best_length < 3) {
+            ++literals;
+            ++i;
+            continue;
+        }
+
+        out.push_back((std::min<size_t>(literals, 15) << 4) | std::min<size_t>(best_length - 3, 15));
+        lz_put_length(out, literals);
+        out.insert(out.end(), in.begin() + i - literals, in.begin() + i);
+        out.push_back(best_distance - 1);
+        lz_put_length(out, best_length - 3);
+        literals = 0;
+        i += best_length;
+    }
+
+    // Trailing literals, the decoder stops before needing a match
+    if (literals) {
+        out.push_back(std::min<size_t>(literals, 15) << 4);
+        lz_put_length(out, literals);
+        out.insert(out.end(), in.end() - literals, in.end());
+    }
+    return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Test images, one per format
+
+struct test_image_format {
+    const char *      name;
+    qp_image_format_t format;
+    uint8_t           bpp;
+    bool              has_palette;
+};
+
+static const test_image_format image_formats[] = {
+    {"gray1", GRAYSCALE_1BPP, 1, false},
+    {"gray2", GRAYSCALE_2BPP, 2, false},
+    {"gray4", GRAYSCALE_4BPP, 4, false},
+    {"gray8", GRAYSCALE_8BPP, 8, false},
+    {"palette1", PALETTE_1BPP, 1, true},
+    {"palette2", PALETTE_2BPP, 2, true},
+    {"palette4", PALETTE_4BPP, 4, true},
+    {"palette8", PALETTE_8BPP, 8, true},
+    {"rgb565", RGB565_16BPP, 16, false},
+    {"rgb888", RGB888_24BPP, 24, false},
+};
+
+#define NUM_IMAGE_FORMATS (sizeof(image_formats) / sizeof(image_formats[0]))
+
+static const char *compression_names[] = {"none", "rle", "lz"};
+
+// Flat runs, then repeating stripes, then noise -- so each compression scheme has something to work with
+static uint8_t image_index(uint16_t x, uint16_t y, uint16_t colors) {
+    if (y < 6) {
+        return (x / 6) % colors;
+    } else if (y < 13) {
+        return ((x + y) / 2) % colors;
+    }
+    return (x * 7 + y * 13 + x * y) % colors;
+}
+
+static hsv_t palette_entry(uint16_t index) {
+    return (hsv_t){(uint8_t)(index * 47), (uint8_t)(255 - (index * 29) % 128), (uint8_t)(128 + (index * 61) % 128)};
+}
+
+static rgb_t native_color(uint16_t index) {
+    return (rgb_t){(uint8_t)(index * 37), (uint8_t)(index * 91 + 16), (uint8_t)(index * 53 + 128)};
+}
+
+static uint16_t image_colors(const test_image_format &fmt) {
+    return fmt.bpp <= 8 ? (1u << fmt.bpp) : 16;
+}
+
+// The pixel the host should end up with, for formats that don't need interpolation
+static rgb_t expected_pixel(const test_image_format &fmt, uint16_t x, uint16_t y) {
+    uint8_t index = image_index(x, y, image_colors(fmt));
+    if (fmt.has_palette) {
+        return hsv_to_rgb_nocie(palette_entry(index));
+    }
+    rgb_t rgb = native_color(index);
+    if (fmt.bpp == 16) {
+        rgb.r = (rgb.r & 0xF8) | (rgb.r >> 5);
+        rgb.g = (rgb.g & 0xFC) | (rgb.g >> 6);
+        rgb.b = (rgb.b & 0xF8) | (rgb.b >> 5);
+    }
+    return rgb;
+}
+
+static std::vector<uint8_t> build_image(const test_image_format &fmt, painter_compression_t compression) {
+    // Raw pixel data, packed least-significant bits first
+    std::vector<uint8_t> raw;
+    uint8_t              byte = 0, bit = 0;
+    for (uint16_t y = 0; y < IMAGE_HEIGHT; ++y) {
+        for (uint16_t x = 0; x < IMAGE_WIDTH; ++x) {
+            uint8_t index = image_index(x, y, image_colors(fmt));
+            if (fmt.bpp == 24) {
+                rgb_t rgb = native_color(index);
+                raw.insert(raw.end(), {rgb.r, rgb.g, rgb.b});
+            } else if (fmt.bpp == 16) {
+                rgb_t    rgb    = native_color(index);
+                uint16_t rgb565 = ((rgb.r >> 3) << 11) | ((rgb.g >> 2) << 5) | (rgb.b >> 3);
+                raw.insert(raw.end(), {(uint8_t)(rgb565 >> 8), (uint8_t)rgb565});
+            } else {
+                byte |= index << bit;
+                bit += fmt.bpp;
+                if (bit == 8) {
+                    raw.push_back(byte);
+                    byte = bit = 0;
+                }
+            }
+        }
+    }
+    if (bit) {
+        raw.push_back(byte);
+    }
+
+    std::vector<uint8_t> data = compression == IMAGE_COMPRESSED_RLE ? rle_compress(raw) : compression == IMAGE_COMPRESSED_LZ ? lz_compress(raw) : raw;
+
+    std::vector<uint8_t> out;
+
+    // Graphics descriptor, the total size gets patched in at the end
+    qp_test_put_header(out, 0x00, 18);
+    qp_test_put(out, 0x464751, 3);
+    qp_test_put(out, 0x01, 1);
+    qp_test_put(out, 0, 4);
+    qp_test_put(out, 0, 4);
+    qp_test_put(out, IMAGE_WIDTH, 2);
+    qp_test_put(out, IMAGE_HEIGHT, 2);
+    qp_test_put(out, 1, 2);
+
+    // Frame offsets
+    qp_test_put_header(out, 0x01, 4);
+    qp_test_put(out, out.size() + 4, 4);
+
+    // Frame descriptor
+    qp_test_put_header(out, 0x02, 6);
+    qp_test_put(out, fmt.format, 1);
+    qp_test_put(out, 0, 1); // flags
+    qp_test_put(out, compression, 1);
+    qp_test_put(out, 0, 1); // transparency_index
+    qp_test_put(out, 0, 2); // delay
+
+    // Palette
+    if (fmt.has_palette) {
+        qp_test_put_header(out, 0x03, image_colors(fmt) * 3);
+        for (uint16_t i = 0; i < image_colors(fmt); ++i) {
+            hsv_t hsv = palette_entry(i);
+            qp_test_put(out, hsv.h, 1);
+            qp_test_put(out, hsv.s, 1);
+            qp_test_put(out, hsv.v, 1);
+        }
+    }
+
+    // Frame data
+    qp_test_put_header(out, 0x05, data.size());
+    out.insert(out.end(), data.begin(), data.end());
+
+    qp_test_patch_total(out, 9);
+    return out;
+}
+
+// Images are built and loaded on first use, and stay loaded for the duration of the test run
+static painter_image_handle_t test_image(size_t format_index, painter_compression_t compression) {
+    static std::vector<uint8_t> data[NUM_IMAGE_FORMATS][3];
+    static painter_image_handle_t images[NUM_IMAGE_FORMATS][3];
+    if (!images[format_index][compression]) {
+        data[format_index][compression]   = build_image(image_formats[format_index], compression);
+        images[format_index][compression] = qp_load_image_mem(data[format_index][compression].data());
+    }
+    return images[format_index][compression];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Test font, 2bpp covering the ASCII table
+
+static uint8_t glyph_width(char c) {
+    return 4 + (c % 4);
+}
+
+static uint8_t glyph_pixel(char c, uint8_t x, uint8_t y) {
+    return (x * 5 + y * 3 + c) % 4;
+}
+
+static std::vector<uint8_t> build_font(void) {
+    std::vector<uint8_t>  glyphs;
+    std::vector<uint32_t> offsets;
+    for (char c = 0x20; c < 0x7F; ++c) {
+        offsets.push_back(glyphs.size());
+        uint8_t byte = 0, bit = 0;
+        for (uint8_t y = 0; y < LINE_HEIGHT; ++y) {
+            for (uint8_t x = 0; x < glyph_width(c); ++x) {
+                byte |= glyph_pixel(c, x, y) << bit;
+                bit += 2;
+                if (bit == 8) {
+                    glyphs.push_back(byte);
+                    byte = bit = 0;
+                }
+            }
+        }
+        if (bit) {
+            glyphs.push_back(byte);
+        }
+    }
+
+    std::vector<uint8_t> out;
+    uint32_t total = 25 + 290 + 5 + glyphs.size();
+
+    // Font descriptor
+    qp_test_put_header(out, 0x00, 20);
+    qp_test_put(out, 0x464651, 3);
+    qp_test_put(out, 0x01, 1);
+    qp_test_put(out, total, 4);
+    qp_test_put(out, ~total, 4);
+    qp_test_put(out, LINE_HEIGHT, 1);
+    qp_test_put(out, 1, 1);    // has_ascii_table
+    qp_test_put(out, 0, 2);    // num_unicode_glyphs
+    qp_test_put(out, 0x01, 1); // GRAYSCALE_2BPP
+    qp_test_put(out, 0, 1);    // flags
+    qp_test_put(out, 0, 1);    // uncompressed
+    qp_test_put(out, 0, 1);    // transparency_index
+
+    // ASCII glyph table
+    qp_test_put_header(out, 0x01, 95 * 3);
+    for (char c = 0x20; c < 0x7F; ++c) {
+        qp_test_put(out, glyph_width(c) | (offsets[c - 0x20] << 6), 3);
+    }
+
+    // Glyph data
+    qp_test_put_header(out, 0x04, glyphs.size());
+    out.insert(out.end(), glyphs.begin(), glyphs.end());
+    return out;
+}
+
+static painter_font_handle_t test_font(void) {
+    static std::vector<uint8_t> data = build_font();
+    static painter_font_handle_t font;
+    if (!font) {
+        font = qp_load_font_mem(data.data());
+    }
+    return font;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Scenes
+
+static bool draw_lines(painter_device_t device, uint16_t ox, uint16_t oy) {
+    static const uint16_t ends[][2] = {{63, 32}, {63, 50}, {50, 63}, {32, 63}, {14, 63}, {0, 50}, {0, 32}, {0, 14}, {14, 0}, {32, 0}, {50, 0}, {63, 14}};
+    bool                  ok        = true;
+    for (uint8_t i = 0; i < sizeof(ends) / sizeof(ends[0]); ++i) {
+        ok &= qp_line(device, ox + 32 / 2, oy + 32 / 2, ox + ends[i][0] / 2, oy + ends[i][1] / 2, i * 21, 255, 255);
+    }
+    ok &= qp_line(device, ox, oy, ox + 31, oy, 0, 0, 255);
+    ok &= qp_line(device, ox, oy, ox, oy + 31, 0, 0, 255);
+    ok &= qp_line(device, ox + 31, oy + 31, ox + 2, oy + 29, 170, 128, 200);
+    return ok;
+}
+
+static bool draw_rects(painter_device_t device, uint16_t ox, uint16_t oy) {
+    bool ok = true;
+    ok &= qp_rect(device, ox + 1, oy + 1, ox + 12, oy + 7, 0, 255, 255, false);
+    ok &= qp_rect(device, ox + 14, oy + 1, ox + 30, oy + 14, 85, 255, 255, true);
+    ok &= qp_rect(device, ox + 3, oy + 10, ox + 3, oy + 10, 43, 255, 255, true);
+    ok &= qp_rect(device, ox + 1, oy + 17, ox + 30, oy + 18, 128, 255, 160, true);
+    ok &= qp_rect(device, ox + 5, oy + 20, ox + 26, oy + 30, 200, 200, 255, false);
+    return ok;
+}
+
+static bool draw_circles(painter_device_t device, uint16_t ox, uint16_t oy) {
+    static const uint16_t circles[][3] = {{3, 3, 1}, {9, 4, 2}, {17, 5, 3}, {26, 6, 5}, {3, 14, 0}, {9, 14, 2}, {17, 15, 3}, {26, 16, 4}};
+    bool                  ok           = true;
+    for (uint8_t i = 0; i < sizeof(circles) / sizeof(circles[0]); ++i) {
+        ok &= qp_circle(device, ox + circles[i][0], oy + circles[i][1], circles[i][2], i * 31, 255, 255, i >= 4);
+    }
+    ok &= qp_circle(device, ox + 16, oy + 26, 5, 170, 255, 255, false);
+    ok &= qp_circle(device, ox + 16, oy + 26, 3, 21, 255, 255, true);
+    return ok;
+}
+
+static bool draw_ellipses(painter_device_t device, uint16_t ox, uint16_t oy) {
+    bool ok = true;
+    ok &= qp_ellipse(device, ox + 8, oy + 5, 7, 4, 0, 255, 255, false);
+    ok &= qp_ellipse(device, ox + 24, oy + 6, 4, 5, 85, 255, 255, true);
+    ok &= qp_ellipse(device, ox + 4, oy + 20, 1, 8, 43, 255, 255, false);
+    ok &= qp_ellipse(device, ox + 18, oy + 16, 12, 2, 128, 255, 255, true);
+    ok &= qp_ellipse(device, ox + 18, oy + 25, 10, 5, 200, 200, 255, false);
+    return ok;
+}
+
+// Primitives are drawn in a 32x32 region, at each corner of the host
+static bool draw_quadrants(painter_device_t device, std::function<bool(painter_device_t, uint16_t, uint16_t)> draw) {
+    bool ok = true;
+    for (uint16_t i = 0; i < 4; ++i) {
+        ok &= draw(device, (i % 2) * 32, (i / 2) * 32);
+    }
+    return ok;
+}
+
+static bool draw_text(painter_device_t device) {
+    bool ok = true;
+    ok &= qp_drawtext(device, 1, 2, test_font(), "QMK 26") > 0;
+    ok &= qp_drawtext_recolor(device, 1, 14, test_font(), "Paint!", 85, 255, 255, 170, 255, 64) > 0;
+    ok &= qp_drawtext_recolor(device, 3, 40, test_font(), "~{}[]", 0, 0, 255, 0, 255, 255) > 0;
+    return ok;
+}
+
+// The surface is created on first use, and cleared by each qp_init()
+static painter_device_t test_surface(void) {
+    static uint8_t          buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+    static painter_device_t surface = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, buffer);
+    return surface;
+}
+
+// Draws the primitives onto a 16bpp surface, then blits the whole surface to the device
+static bool draw_surface(painter_device_t device) {
+    painter_device_t surface = test_surface();
+    bool             ok      = qp_init(surface, QP_ROTATION_0);
+    ok &= draw_lines(surface, 0, 0);
+    ok &= draw_circles(surface, 0, 0);
+    ok &= qp_surface_draw(surface, device, SURFACE_X, SURFACE_Y, true);
+    return ok;
+}
+
+// Draws anti-aliased shapes over a background on a 16bpp surface, then blits the whole surface to the device
+static bool draw_surface_aa(painter_device_t device) {
+    painter_device_t surface = test_surface();
+    bool             ok      = qp_init(surface, QP_ROTATION_0);
+    ok &= qp_rect(surface, 0, 16, 31, 31, 170, 255, 128, true);
+    ok &= qp_surface_circle_aa(surface, 9, 9, 7, 0, 255, 255, true);
+    ok &= qp_surface_circle_aa(surface, 23, 9, 6, 85, 255, 255, false);
+    ok &= qp_surface_ellipse_aa(surface, 15, 23, 13, 5, 43, 255, 255, true);
+    ok &= qp_surface_ellipse_aa(surface, 15, 23, 8, 3, 0, 0, 255, false);
+    ok &= qp_surface_draw(surface, device, SURFACE_X, SURFACE_Y, true);
+    return ok;
+}
+
+struct golden_scene {
+    std::string                            name;
+    uint8_t                                native_bits_per_pixel;
+    std::function<bool(painter_device_t)> draw;
+    uint32_t                               hash;
+    uint32_t                               viewports;
+    uint32_t                               bytes;
+};
+
+// Golden framebuffer hashes and comms traffic for each scene. Set QP_TEST_DUMP_DIR to write each framebuffer out as a
+// PPM when checking any change to the expected values.
+static std::vector<golden_scene> golden_scenes(void) {
+    // clang-format off
+    std::vector<golden_scene> scenes = {
+        {"line",       24, [](painter_device_t d) { return draw_quadrants(d, draw_lines); },    0xCCE645FD, 672, 10224},
+        {"rect",       24, [](painter_device_t d) { return draw_quadrants(d, draw_rects); },    0x160B25F5,  44,  5180},
+        {"circle",     24, [](painter_device_t d) { return draw_quadrants(d, draw_circles); },  0x549BD3E5, 428,  7316},
+        {"ellipse",    24, [](painter_device_t d) { return draw_quadrants(d, draw_ellipses); }, 0x49604EB5, 220,  5512},
+        {"drawtext",   24, draw_text,                                                           0xEA99978D,  17,  2378},
+        {"surface",    16, draw_surface,                                                        0x32201290,   1,  2058},
+        {"surface_aa", 16, draw_surface_aa,                                                     0x88E4CDDF,   1,  2058},
+    };
+
+    // Every compression scheme must produce the same result for a given format
+    static const uint32_t image_goldens[NUM_IMAGE_FORMATS][3] = {
+        {0xED5E1065, 1, 1450}, // gray1
+        {0x53247ADB, 1, 1450}, // gray2
+        {0xC8BA8A0A, 1, 1450}, // gray4
+        {0xF86B2B30, 1, 1450}, // gray8
+        {0xDAF6FB71, 1, 1450}, // palette1
+        {0x8E3C3F1D, 1, 1450}, // palette2
+        {0x7BE911B3, 1, 1450}, // palette4
+        {0x9A076724, 1, 1450}, // palette8
+        {0xF2E18306, 1,  970}, // rgb565
+        {0xAA58E259, 1, 1450}, // rgb888
+    };
+    // clang-format on
+
+    for (size_t i = 0; i < NUM_IMAGE_FORMATS; ++i) {
+        for (uint8_t c = IMAGE_UNCOMPRESSED; c <= IMAGE_COMPRESSED_LZ; ++c) {
+            auto draw = [i, c](painter_device_t d) { return qp_drawimage_recolor(d, IMAGE_X, IMAGE_Y, test_image(i, (painter_compression_t)c), 85, 255, 255, 200, 255, 48); };
+            scenes.push_back({std::string("drawimage_") + image_formats[i].name + "_" + compression_names[c], (uint8_t)(image_formats[i].bpp == 16 ? 16 : 24), draw, image_goldens[i][0], image_goldens[i][1], image_goldens[i][2]});
+        }
+    }
+    return scenes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests
+
+class QPDrawGolden : public ::testing::Test {
+   protected:
+    qp_test_host_t host;
+
+    void MakeHost(uint8_t native_bits_per_pixel) {
+        ASSERT_TRUE(qp_test_host_make(&host, HOST_WIDTH, HOST_HEIGHT, native_bits_per_pixel));
+    }
+};
+
+TEST_F(QPDrawGolden, ScenesMatchGoldens) {
+    for (const golden_scene &scene : golden_scenes()) {
+        SCOPED_TRACE(scene.name);
+        MakeHost(scene.native_bits_per_pixel);
+        ASSERT_TRUE(scene.draw((painter_device_t)&host));
+        host.dump_if_requested(scene.name);
+
+        EXPECT_EQ(host.hash(), scene.hash) << std::hex << std::showbase << host.hash();
+        EXPECT_EQ(host.stats.viewports, scene.viewports);
+        EXPECT_EQ(host.stats.bytes, scene.bytes);
+    }
+}
+
+TEST_F(QPDrawGolden, ImagesMatchSourcePixels) {
+    for (size_t i = 0; i < NUM_IMAGE_FORMATS; ++i) {
+        const test_image_format &fmt = image_formats[i];
+        if (!fmt.has_palette && fmt.bpp <= 8) {
+            continue; // grayscale is interpolated between the recolor arguments, covered by the goldens instead
+        }
+
+        for (uint8_t c = IMAGE_UNCOMPRESSED; c <= IMAGE_COMPRESSED_LZ; ++c) {
+            SCOPED_TRACE(std::string(fmt.name) + "_" + compression_names[c]);
+            MakeHost(fmt.bpp == 16 ? 16 : 24);
+            ASSERT_TRUE(qp_drawimage(&host, IMAGE_X, IMAGE_Y, test_image(i, (painter_compression_t)c)));
+
+            for (uint16_t y = 0; y < IMAGE_HEIGHT; ++y) {
+                for (uint16_t x = 0; x < IMAGE_WIDTH; ++x) {
+                    rgb_t          rgb = expected_pixel(fmt, x, y);
+                    const uint8_t *px  = host.pixel(IMAGE_X + x, IMAGE_Y + y);
+                    ASSERT_EQ(std::vector<uint8_t>(px, px + 3), std::vector<uint8_t>({rgb.r, rgb.g, rgb.b})) << "at " << x << "," << y;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(QPDrawGolden, CompressedImagesAreSmaller) {
+    for (size_t i = 0; i < NUM_IMAGE_FORMATS; ++i) {
+        SCOPED_TRACE(image_formats[i].name);
+        std::vector<uint8_t> raw = build_image(image_formats[i], IMAGE_UNCOMPRESSED);
+        if (image_formats[i].bpp <= 8) {
+            // RLE works on bytes, so multi-byte native pixels rarely repeat
+            EXPECT_LT(build_image(image_formats[i], IMAGE_COMPRESSED_RLE).size(), raw.size());
+        }
+        EXPECT_LT(build_image(image_formats[i], IMAGE_COMPRESSED_LZ).size(), raw.size());
+    }
+}
+
+TEST_F(QPDrawGolden, MismatchedNativeImageIsRejected) {
+    MakeHost(24);
+    EXPECT_FALSE(qp_drawimage(&host, IMAGE_X, IMAGE_Y, test_image(8, IMAGE_UNCOMPRESSED)));
+    MakeHost(16);
+    EXPECT_FALSE(qp_drawimage(&host, IMAGE_X, IMAGE_Y, test_image(9, IMAGE_UNCOMPRESSED)));
+}
+
+TEST_F(QPDrawGolden, SurfaceBlitMatchesDirectDraw) {
+    MakeHost(16);
+    ASSERT_TRUE(draw_surface(&host));
+    std::vector<uint8_t> blitted = host.framebuffer;
+
+    MakeHost(16);
+    ASSERT_TRUE(draw_lines(&host, SURFACE_X, SURFACE_Y));
+    ASSERT_TRUE(draw_circles(&host, SURFACE_X, SURFACE_Y));
+    EXPECT_EQ(blitted, host.framebuffer);
+}
+
+TEST_F(QPDrawGolden, SurfaceDirtyBlitOnlySendsChanges) {
+    painter_device_t surface = test_surface();
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+    MakeHost(16);
+    ASSERT_TRUE(qp_surface_draw(surface, &host, SURFACE_X, SURFACE_Y, true));
+    uint32_t entire_bytes = host.stats.bytes;
+    EXPECT_EQ(entire_bytes, QP_TEST_HOST_VIEWPORT_BYTES + SURFACE_WIDTH * SURFACE_HEIGHT * 2);
+
+    ASSERT_TRUE(qp_rect(surface, 4, 5, 9, 7, 0, 255, 255, true));
+    host.stats = {};
+    ASSERT_TRUE(qp_surface_draw(surface, &host, SURFACE_X, SURFACE_Y, false));
+    EXPECT_EQ(host.stats.viewports, 1);
+    EXPECT_EQ(host.stats.bytes, QP_TEST_HOST_VIEWPORT_BYTES + 6 * 3 * 2);
+
+    const uint8_t *px = host.pixel(SURFACE_X + 4, SURFACE_Y + 5);
+    EXPECT_EQ(std::vector<uint8_t>(px, px + 3), std::vector<uint8_t>({0xFF, 0x00, 0x00}));
+}
+
+TEST_F(QPDrawGolden, FilledShapesSendEachPixelOnce) {
+    struct shape {
+        std::string                            name;
+        std::function<bool(painter_device_t)> draw;
+        uint16_t                               rows;
+    };
+    std::vector<shape> shapes = {
+        {"circle", [](painter_device_t d) { return qp_circle(d, 32, 32, 20, 0, 255, 255, true); }, 41},
+        {"ellipse_wide", [](painter_device_t d) { return qp_ellipse(d, 32, 32, 28, 9, 85, 255, 255, true); }, 19},
+        {"ellipse_tall", [](painter_device_t d) { return qp_ellipse(d, 32, 32, 6, 25, 170, 255, 255, true); }, 51},
+    };
+
+    for (const shape &s : shapes) {
+        SCOPED_TRACE(s.name);
+        MakeHost(24);
+        ASSERT_TRUE(s.draw(&host));
+
+        uint32_t lit = 0;
+        for (uint16_t y = 0; y < HOST_HEIGHT; ++y) {
+            for (uint16_t x = 0; x < HOST_WIDTH; ++x) {
+                const uint8_t *px = host.pixel(x, y);
+                lit += (px[0] | px[1] | px[2]) ? 1 : 0;
+            }
+        }
+
+        // No row is sent more than once, and rows of equal width are combined
+        EXPECT_EQ(host.stats.bytes, host.stats.viewports * QP_TEST_HOST_VIEWPORT_BYTES + lit * 3);
+        EXPECT_LT(host.stats.viewports, s.rows);
+    }
+}
+
+TEST_F(QPDrawGolden, OutlinesCombineAdjacentPixels) {
+    MakeHost(24);
+    ASSERT_TRUE(qp_circle(&host, 32, 32, 20, 0, 255, 255, false));
+    uint32_t circle_viewports = host.stats.viewports;
+
+    MakeHost(24);
+    ASSERT_TRUE(qp_ellipse(&host, 32, 32, 28, 9, 85, 255, 255, false));
+    uint32_t ellipse_viewports = host.stats.viewports;
+
+    // Each pixel used to be sent with its own viewport
+    uint32_t lit = 0;
+    for (uint16_t y = 0; y < HOST_HEIGHT; ++y) {
+        for (uint16_t x = 0; x < HOST_WIDTH; ++x) {
+            lit += host.pixel(x, y)[1] ? 1 : 0;
+        }
+    }
+    EXPECT_LT(circle_viewports, 4 * 41);
+    EXPECT_LT(ellipse_viewports, lit / 2);
+}
+
+TEST_F(QPDrawGolden, AntiAliasedCircleCoversAliasedPixels) {
+    painter_device_t surface = test_surface();
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    ASSERT_TRUE(qp_surface_circle_aa(surface, 15, 15, 10, 0, 0, 255, true));
+    MakeHost(16);
+    ASSERT_TRUE(qp_surface_draw(surface, &host, 0, 0, true));
+    std::vector<uint8_t> aa = host.framebuffer;
+
+    MakeHost(16);
+    ASSERT_TRUE(qp_circle(&host, 15, 15, 10, 0, 0, 255, true));
+
+    // The circle is centered in the 31x31 area at the top left of the surface
+    uint32_t partial = 0;
+    for (uint16_t y = 0; y <= 30; ++y) {
+        for (uint16_t x = 0; x <= 30; ++x) {
+            uint8_t value    = aa[(y * HOST_WIDTH + x) * 3 + 1];
+            uint8_t mirrored = aa[((30 - y) * HOST_WIDTH + (30 - x)) * 3 + 1];
+            int32_t dx = x - 15, dy = y - 15;
+            ASSERT_EQ(value, mirrored) << "at " << x << "," << y;
+            if (host.pixel(x, y)[1] != 0) {
+                EXPECT_NE(value, 0) << "at " << x << "," << y;
+            }
+            if (dx * dx + dy * dy <= 9 * 9) {
+                EXPECT_EQ(value, 0xFF) << "at " << x << "," << y;
+            }
+            if (dx * dx + dy * dy >= 12 * 12) {
+                EXPECT_EQ(value, 0) << "at " << x << "," << y;
+            }
+            partial += (value != 0 && value != 0xFF) ? 1 : 0;
+        }
+    }
+    EXPECT_GT(partial, 0);
+
+    // Only RGB565 surfaces can be blended into
+    EXPECT_FALSE(qp_surface_circle_aa(&host, 15, 15, 10, 0, 0, 255, true));
+}
+
+// Run with --gtest_also_run_disabled_tests to print the time and bytes sent for each call
+TEST_F(QPDrawGolden, DISABLED_Benchmark) {
+    using clock = std::chrono::steady_clock;
+
+    const uint32_t loops = 200;
+    std::cout << std::left << std::setw(28) << "call" << std::right << std::setw(12) << "ns/call" << std::setw(12) << "bytes/call" << std::setw(12) << "viewports" << std::setw(12) << "commands" << std::endl;
+    for (const golden_scene &scene : golden_scenes()) {
+        MakeHost(scene.native_bits_per_pixel);
+        auto start = clock::now();
+        for (uint32_t i = 0; i < loops; ++i) {
+            scene.draw((painter_device_t)&host);
+        }
+        double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / loops;
+        std::cout << std::left << std::setw(28) << scene.name << std::right << std::fixed << std::setprecision(0) << std::setw(12) << ns << std::setw(12) << (double)host.stats.bytes / loops << std::setw(12) << (double)host.stats.viewports / loops << std::setw(12) << (double)host.stats.commands / loops << std::endl;
+    }
+}
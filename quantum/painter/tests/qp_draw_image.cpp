@@ -0,0 +1,349 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "qp_test_host.hpp"
+#include "qp_test_panel.hpp"
+
+#include <algorithm>
+#include <functional>
+
+extern "C" {
+#include "qgf.h"
+#include "timer.h"
+void qp_internal_animation_tick(void);
+void advance_time(uint32_t ms);
+}
+
+#define PANEL_WIDTH 32
+#define PANEL_HEIGHT 32
+#define IMAGE_WIDTH 32
+#define IMAGE_HEIGHT 16
+#define FRAME_DELAY 20
+
+// Frame contents, as 4bpp grayscale palette indices
+static uint8_t frame0(uint16_t x, uint16_t y) {
+    return (((x / 4) + (y / 2)) % 16) ^ ((x * y) % 7 == 0 ? 5 : 0);
+}
+
+static uint8_t frame1(uint16_t x, uint16_t y) {
+    // Delta frame, relative to its rectangle
+    return (x * 3 + y * 5) % 16;
+}
+
+static uint8_t frame2(uint16_t x, uint16_t y) {
+    return x == y * 2 ? 3 : 0;
+}
+
+static uint8_t frame3(uint16_t x, uint16_t y) {
+    return (x ^ y) & 15;
+}
+
+// The above frames, compressed using `qmk painter-convert-graphics --lz`
+static const uint8_t frame0_lz[] = {
+    0xFD, 0x21, 0x55, 0x55, 0x44, 0x44, 0x77, 0x77, 0x66, 0x66, 0x11, 0x11, 0x00, 0x00, 0x33, 0x33, 0x22, 0x22, 0x05, 0x00, 0x11, 0x41, 0x22, 0x22, 0x33, 0x36, 0x44, 0x44, 0x05, 0x55, 0x66, 0x66, 0x72, 0x77, 0x14, 0x11, 0x22, 0x72, 0x33, 0x33, 0x44, 0x41, 0x55, 0x55, 0x36, 0x66, 0x77, 0x77, 0x8D, 0x88, 0x0F, 0xFD, 0x01, 0x27, 0x22, 0x33, 0x63, 0x44, 0x44, 0x55, 0x50, 0x66, 0x66, 0x27, 0x77, 0x88, 0x88, 0x9C, 0x99, 0x0F, 0xF7, 0x01, 0x36, 0x33, 0x44, 0x14, 0x55, 0x55, 0x66, 0x63, 0x77, 0x77, 0xD8, 0x88, 0x99, 0x99, 0xAF, 0xAA, 0x69, 0xFD, 0x07, 0xDD, 0xDD, 0xCC, 0xCC, 0xFF, 0xFF, 0x41, 0x44, 0x55, 0x05, 0x66, 0x66, 0x77, 0x72, 0x88, 0x88, 0xC9, 0x99, 0xAA, 0xAA, 0xBE, 0xBB, 0x0F, 0xFD, 0x01, 0x50, 0x55, 0x66, 0x36, 0x77, 0x77, 0x88, 0x8D, 0x99, 0x99, 0xFA, 0xAA, 0xBB, 0xBB, 0xC9, 0xCC, 0x0F, 0xFD, 0x01, 0x63, 0x66, 0x77, 0x27, 0x88, 0x88, 0x99, 0x9C, 0xAA, 0xAA, 0xEB, 0xBB, 0xCC, 0xCC, 0xD8, 0xDD, 0x0F, 0x05, 0x67, 0xF0, 0x09, 0xEE, 0xEE, 0x99, 0x99, 0x88, 0x88, 0xBB, 0xBB, 0x72, 0x77, 0x88, 0xD8, 0x99, 0x99, 0xAA, 0xAF, 0xBB, 0xBB, 0x9C, 0xCC, 0xDD, 0xDD, 0xEB, 0xEE,
+};
+
+static const uint8_t frame1_lz[] = {
+    0xF4, 0x02, 0x30, 0x96, 0xFC, 0x52, 0xB8, 0x1E, 0x74, 0xDA, 0x85, 0xEB, 0x41, 0xA7, 0x0D, 0x63, 0xC9, 0x2F, 0xDA, 0x10, 0x14, 0x2F, 0x10, 0x14, 0x74, 0x10, 0x14, 0xC9, 0x10, 0x00, 0x2A, 0x02, 0x10, 0x00, 0x2A, 0x02, 0x10,
+};
+
+static const uint8_t frame2_lz[] = {
+    0x2C, 0x03, 0x00, 0x00, 0x0F, 0x10, 0xDD,
+};
+
+struct test_rect {
+    uint16_t l, t, r, b;
+};
+
+struct test_frame {
+    std::function<uint8_t(uint16_t x, uint16_t y)> pixel; // relative to each rectangle
+    std::vector<test_rect>                         rects; // delta rectangles, or empty for the full image
+};
+
+static const std::vector<test_frame> frames = {
+    {frame0, {}},
+    {frame1, {{8, 4, 23, 11}}},
+    {frame2, {}},
+    {frame3, {}},
+};
+
+// Builds a 4bpp grayscale QGF with the supplied frames, either uncompressed or using the supplied compressed data
+static std::vector<uint8_t> build_image(const std::vector<test_frame> &frames, const std::vector<const std::vector<uint8_t> *> &compressed, std::vector<uint32_t> &offsets) {
+    std::vector<uint8_t> out;
+
+    // Graphics descriptor, the total size gets patched in at the end
+    qp_test_put_header(out, 0x00, 18);
+    qp_test_put(out, 0x464751, 3);
+    qp_test_put(out, 0x01, 1);
+    qp_test_put(out, 0, 4);
+    qp_test_put(out, 0, 4);
+    qp_test_put(out, IMAGE_WIDTH, 2);
+    qp_test_put(out, IMAGE_HEIGHT, 2);
+    qp_test_put(out, frames.size(), 2);
+
+    // Frame offsets, patched as each frame is written
+    qp_test_put_header(out, 0x01, frames.size() * 4);
+    size_t offsets_pos = out.size();
+    qp_test_put(out, 0, frames.size() * 4);
+
+    offsets.clear();
+    for (size_t i = 0; i < frames.size(); ++i) {
+        const test_frame &frame = frames[i];
+        offsets.push_back(out.size());
+        for (uint8_t k = 0; k < 4; ++k) {
+            out[offsets_pos + i * 4 + k] = (offsets[i] >> (k * 8)) & 0xFF;
+        }
+
+        // Raw pixel data, two pixels per byte, with each rectangle starting on a byte boundary
+        std::vector<test_rect> rects = frame.rects.empty() ? std::vector<test_rect>{{0, 0, IMAGE_WIDTH - 1, IMAGE_HEIGHT - 1}} : frame.rects;
+        std::vector<uint8_t>   raw;
+        for (const test_rect &rect : rects) {
+            uint8_t byte = 0, bit = 0;
+            for (uint16_t y = 0; y <= rect.b - rect.t; ++y) {
+                for (uint16_t x = 0; x <= rect.r - rect.l; ++x) {
+                    byte |= frame.pixel(x, y) << bit;
+                    bit += 4;
+                    if (bit == 8) {
+                        raw.push_back(byte);
+                        byte = bit = 0;
+                    }
+                }
+            }
+            if (bit) {
+                raw.push_back(byte);
+            }
+        }
+
+        const std::vector<uint8_t> *packed = i < compressed.size() ? compressed[i] : nullptr;
+        const std::vector<uint8_t> *data   = packed ? packed : &raw;
+
+        // Frame descriptor
+        qp_test_put_header(out, 0x02, 6);
+        qp_test_put(out, 0x02, 1);                              // GRAYSCALE_4BPP
+        qp_test_put(out, frame.rects.empty() ? 0x00 : 0x02, 1); // flags
+        qp_test_put(out, packed ? 0x02 : 0x00, 1);              // compression
+        qp_test_put(out, 0, 1);                                 // transparency_index
+        qp_test_put(out, FRAME_DELAY, 2);                       // delay
+
+        // Delta descriptor
+        if (!frame.rects.empty()) {
+            qp_test_put_header(out, 0x04, frame.rects.size() * 8);
+            for (const test_rect &rect : frame.rects) {
+                qp_test_put(out, rect.l, 2);
+                qp_test_put(out, rect.t, 2);
+                qp_test_put(out, rect.r, 2);
+                qp_test_put(out, rect.b, 2);
+            }
+        }
+
+        // Frame data
+        qp_test_put_header(out, 0x05, data->size());
+        out.insert(out.end(), data->begin(), data->end());
+    }
+
+    qp_test_patch_total(out, 9);
+    return out;
+}
+
+class QPDrawImage : public ::testing::Test {
+   protected:
+    painter_driver_t       panel;
+    std::vector<uint8_t>   frame0_data{std::begin(frame0_lz), std::end(frame0_lz)};
+    std::vector<uint8_t>   frame1_data{std::begin(frame1_lz), std::end(frame1_lz)};
+    std::vector<uint8_t>   frame2_data{std::begin(frame2_lz), std::end(frame2_lz)};
+    std::vector<uint8_t>   raw_data;
+    std::vector<uint8_t>   lz_data;
+    std::vector<uint32_t>  raw_offsets;
+    std::vector<uint32_t>  lz_offsets;
+    painter_image_handle_t raw_image;
+    painter_image_handle_t lz_image;
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_test_panel_init(&panel, PANEL_WIDTH, PANEL_HEIGHT));
+
+        // The last frame is left uncompressed, so the image mixes compression schemes
+        raw_data = build_image(frames, {}, raw_offsets);
+        lz_data  = build_image(frames, {&frame0_data, &frame1_data, &frame2_data}, lz_offsets);
+        ASSERT_LT(lz_data.size(), raw_data.size());
+
+        raw_image = qp_load_image_mem(raw_data.data());
+        lz_image  = qp_load_image_mem(lz_data.data());
+        ASSERT_NE(raw_image, nullptr);
+        ASSERT_NE(lz_image, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_image(raw_image);
+        qp_close_image(lz_image);
+    }
+
+    // Compares the top half of the panel against the bottom half
+    void ExpectHalvesMatch() {
+        std::vector<uint16_t> top(recorder.image.begin(), recorder.image.begin() + PANEL_WIDTH * IMAGE_HEIGHT);
+        std::vector<uint16_t> bottom(recorder.image.begin() + PANEL_WIDTH * IMAGE_HEIGHT, recorder.image.end());
+        EXPECT_EQ(top, bottom);
+        EXPECT_EQ(std::count(top.begin(), top.end(), UNTOUCHED), 0);
+    }
+};
+
+TEST_F(QPDrawImage, CompressedMatchesUncompressed) {
+    ASSERT_TRUE(qp_drawimage(&panel, 0, 0, lz_image));
+    ASSERT_TRUE(qp_drawimage(&panel, 0, IMAGE_HEIGHT, raw_image));
+    ExpectHalvesMatch();
+}
+
+TEST_F(QPDrawImage, CompressedAnimationMatchesUncompressed) {
+    deferred_token lz_token  = qp_animate(&panel, 0, 0, lz_image);
+    deferred_token raw_token = qp_animate(&panel, 0, IMAGE_HEIGHT, raw_image);
+    ASSERT_NE(lz_token, INVALID_DEFERRED_TOKEN);
+    ASSERT_NE(raw_token, INVALID_DEFERRED_TOKEN);
+    ExpectHalvesMatch();
+
+    // Run through every frame twice, so that each is decoded after every other
+    for (size_t i = 1; i < frames.size() * 2; ++i) {
+        recorder.reset();
+        advance_time(FRAME_DELAY);
+        qp_internal_animation_tick();
+        EXPECT_EQ(recorder.viewports, 2);
+        ExpectHalvesMatch();
+    }
+
+    qp_stop_animation(lz_token);
+    qp_stop_animation(raw_token);
+}
+
+TEST_F(QPDrawImage, SeekToFrameUsesOffsets) {
+    qp_memory_stream_t mem_stream = qp_make_memory_stream(lz_data.data(), lz_data.size());
+    qp_stream_t       *stream     = (qp_stream_t *)&mem_stream;
+    ASSERT_TRUE(qgf_validate_stream(stream));
+
+    // Seek in reverse order, so no frame is reached by reading through the previous one
+    for (size_t i = frames.size(); i-- > 0;) {
+        qgf_seek_to_frame_descriptor(stream, i);
+        EXPECT_EQ(qp_stream_tell(stream), lz_offsets[i]);
+    }
+}
+
+TEST_F(QPDrawImage, DeltaRectsOnlySendChangedRegions) {
+    // Two far-apart changes, one of which doesn't fill its last byte
+    const std::vector<test_frame> delta_frames = {
+        {frame3, {}},
+        {frame1, {{0, 0, 4, 2}, {26, 13, 31, 15}}},
+    };
+
+    // The same animation, with every frame drawn in full
+    auto merged = [](uint16_t x, uint16_t y) -> uint8_t {
+        if (x <= 4 && y <= 2) {
+            return frame1(x, y);
+        }
+        if (x >= 26 && y >= 13) {
+            return frame1(x - 26, y - 13);
+        }
+        return frame3(x, y);
+    };
+    const std::vector<test_frame> full_frames = {
+        {frame3, {}},
+        {merged, {}},
+    };
+
+    std::vector<uint32_t>  offsets;
+    std::vector<uint8_t>   delta_data = build_image(delta_frames, {}, offsets);
+    std::vector<uint8_t>   full_data  = build_image(full_frames, {}, offsets);
+    painter_image_handle_t delta      = qp_load_image_mem(delta_data.data());
+    painter_image_handle_t full       = qp_load_image_mem(full_data.data());
+    ASSERT_NE(delta, nullptr);
+    ASSERT_NE(full, nullptr);
+
+    deferred_token delta_token = qp_animate(&panel, 0, 0, delta);
+    deferred_token full_token  = qp_animate(&panel, 0, IMAGE_HEIGHT, full);
+    ASSERT_NE(delta_token, INVALID_DEFERRED_TOKEN);
+    ASSERT_NE(full_token, INVALID_DEFERRED_TOKEN);
+    ExpectHalvesMatch();
+
+    // Both frames are due in the same tick, so they share a single comms transaction
+    recorder.reset();
+    advance_time(FRAME_DELAY);
+    qp_internal_animation_tick();
+    ExpectHalvesMatch();
+    EXPECT_EQ(recorder.starts, 1);
+    EXPECT_EQ(recorder.viewports, 3);
+
+    qp_animation_tick_stats_t stats = qp_get_animation_tick_stats();
+    EXPECT_EQ(stats.frames, 2);
+    EXPECT_EQ(stats.transactions, 1);
+    EXPECT_EQ(stats.rects, 3);
+    EXPECT_EQ(stats.pixels, 5 * 3 + 6 * 3 + IMAGE_WIDTH * IMAGE_HEIGHT);
+    EXPECT_EQ(recorder.bytes, 3 * VIEWPORT_BYTES + stats.pixels * 2);
+
+    qp_stop_animation(delta_token);
+    qp_stop_animation(full_token);
+    qp_close_image(delta);
+    qp_close_image(full);
+}
+
+// Two displays on the same bus, which can only be started by one of them at a time
+static painter_device_t bus_owner = NULL;
+
+static bool shared_bus_start(painter_device_t device) {
+    if (bus_owner != NULL) {
+        return false;
+    }
+    bus_owner = device;
+    return recorder_start(device);
+}
+
+static void shared_bus_stop(painter_device_t device) {
+    recorder_stop(device);
+    if (bus_owner == device) {
+        bus_owner = NULL;
+    }
+}
+
+TEST_F(QPDrawImage, AnimationsOnDisplaysSharingABus) {
+    static painter_comms_with_command_vtable_t shared_bus_comms_vtable = recorder_comms_vtable;
+    shared_bus_comms_vtable.base.comms_start                           = shared_bus_start;
+    shared_bus_comms_vtable.base.comms_stop                            = shared_bus_stop;
+
+    painter_driver_t other = panel;
+    panel.comms_vtable     = (const painter_comms_vtable_t *)&shared_bus_comms_vtable;
+    other.comms_vtable     = (const painter_comms_vtable_t *)&shared_bus_comms_vtable;
+
+    deferred_token tokens[3] = {
+        qp_animate(&panel, 0, 0, raw_image),
+        qp_animate(&panel, 0, IMAGE_HEIGHT, lz_image),
+        qp_animate(&other, 0, 0, lz_image),
+    };
+    for (deferred_token token : tokens) {
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+    }
+
+    // Every frame is due in the same tick, and each display gets the bus in turn
+    for (size_t i = 0; i < frames.size(); ++i) {
+        recorder.reset();
+        advance_time(FRAME_DELAY);
+        qp_internal_animation_tick();
+        EXPECT_EQ(bus_owner, nullptr);
+
+        qp_animation_tick_stats_t stats = qp_get_animation_tick_stats();
+        EXPECT_EQ(stats.frames, 3);
+        EXPECT_EQ(stats.transactions, 2);
+        EXPECT_EQ(recorder.starts, 2);
+    }
+
+    for (deferred_token token : tokens) {
+        qp_stop_animation(token);
+    }
+}
+
+TEST_F(QPDrawImage, InvalidDeltaRectCountIsRejected) {
+    const std::vector<test_frame> too_many = {
+        {frame3, {}},
+        {frame1, {{0, 0, 1, 1}, {2, 2, 3, 3}, {4, 4, 5, 5}, {6, 6, 7, 7}, {8, 8, 9, 9}}},
+    };
+
+    std::vector<uint32_t> offsets;
+    std::vector<uint8_t>  data = build_image(too_many, {}, offsets);
+    EXPECT_EQ(qp_load_image_mem(data.data()), nullptr);
+}
@@ -0,0 +1,196 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "qp_test_host.hpp"
+
+#define HOST_WIDTH 32
+#define HOST_HEIGHT 32
+#define IMAGE_WIDTH 8
+#define IMAGE_HEIGHT 4
+
+// Counts palette conversions, as performed by the host's normal conversion hooks
+static uint32_t converts;
+static uint32_t converted_entries;
+
+static bool counting_palette_convert_rgb565(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    converts++;
+    converted_entries += palette_size;
+    return qp_tft_panel_palette_convert_rgb565_swapped(device, palette_size, palette);
+}
+
+static bool counting_palette_convert_rgb888(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    converts++;
+    converted_entries += palette_size;
+    return qp_tft_panel_palette_convert_rgb888(device, palette_size, palette);
+}
+
+static painter_driver_vtable_t counting_rgb565_vtable;
+static painter_driver_vtable_t counting_rgb888_vtable;
+
+// Builds a single-frame uncompressed QGF, with a palette if supplied
+static std::vector<uint8_t> build_image(uint8_t format, uint8_t bpp, const std::vector<uint8_t> &palette_hsv) {
+    std::vector<uint8_t> out;
+
+    // Every palette index in turn
+    std::vector<uint8_t> raw;
+    uint8_t              byte = 0, bit = 0;
+    for (uint16_t i = 0; i < IMAGE_WIDTH * IMAGE_HEIGHT; ++i) {
+        byte |= (i % (1 << bpp)) << bit;
+        bit += bpp;
+        if (bit == 8) {
+            raw.push_back(byte);
+            byte = bit = 0;
+        }
+    }
+
+    qp_test_put_header(out, 0x00, 18);
+    qp_test_put(out, 0x464751, 3);
+    qp_test_put(out, 0x01, 1);
+    qp_test_put(out, 0, 4);
+    qp_test_put(out, 0, 4);
+    qp_test_put(out, IMAGE_WIDTH, 2);
+    qp_test_put(out, IMAGE_HEIGHT, 2);
+    qp_test_put(out, 1, 2);
+    qp_test_put_header(out, 0x01, 4);
+    qp_test_put(out, out.size() + 4, 4);
+    qp_test_put_header(out, 0x02, 6);
+    qp_test_put(out, format, 1);
+    qp_test_put(out, 0, 1);
+    qp_test_put(out, 0, 1);
+    qp_test_put(out, 0, 1);
+    qp_test_put(out, 0, 2);
+    if (!palette_hsv.empty()) {
+        qp_test_put_header(out, 0x03, palette_hsv.size());
+        out.insert(out.end(), palette_hsv.begin(), palette_hsv.end());
+    }
+    qp_test_put_header(out, 0x05, raw.size());
+    out.insert(out.end(), raw.begin(), raw.end());
+
+    qp_test_patch_total(out, 9);
+    return out;
+}
+
+class QPDrawPalette : public ::testing::Test {
+   protected:
+    qp_test_host_t         host;
+    qp_test_host_t         other;
+    std::vector<uint8_t>   gray_data    = build_image(GRAYSCALE_4BPP, 4, {});
+    std::vector<uint8_t>   palette_data = build_image(PALETTE_1BPP, 1, {0, 255, 255, 85, 255, 255});
+    painter_image_handle_t gray;
+    painter_image_handle_t palette;
+
+    void SetUp() override {
+        counting_rgb565_vtable                 = qp_test_host_rgb565_vtable;
+        counting_rgb565_vtable.palette_convert = counting_palette_convert_rgb565;
+        counting_rgb888_vtable                 = qp_test_host_rgb888_vtable;
+        counting_rgb888_vtable.palette_convert = counting_palette_convert_rgb888;
+
+        ASSERT_TRUE(qp_test_host_make(&host, HOST_WIDTH, HOST_HEIGHT, 24));
+        ASSERT_TRUE(qp_test_host_make(&other, HOST_WIDTH, HOST_HEIGHT, 16));
+        host.base.driver_vtable  = &counting_rgb888_vtable;
+        other.base.driver_vtable = &counting_rgb565_vtable;
+
+        gray    = qp_load_image_mem(gray_data.data());
+        palette = qp_load_image_mem(palette_data.data());
+        ASSERT_NE(gray, nullptr);
+        ASSERT_NE(palette, nullptr);
+
+        // Palettes stay cached between tests, so each test sticks to its own set of colours
+        converts = converted_entries = 0;
+    }
+
+    void TearDown() override {
+        qp_close_image(gray);
+        qp_close_image(palette);
+    }
+
+    // Renders the image onto a fresh host of the given format, for comparison
+    std::vector<uint8_t> Reference(uint8_t native_bits_per_pixel, painter_image_handle_t image, uint8_t hue_fg, uint8_t hue_bg) {
+        qp_test_host_t reference;
+        EXPECT_TRUE(qp_test_host_make(&reference, HOST_WIDTH, HOST_HEIGHT, native_bits_per_pixel));
+        EXPECT_TRUE(qp_drawimage_recolor(&reference, 0, 0, image, hue_fg, 255, 255, hue_bg, 255, 64));
+        return reference.framebuffer;
+    }
+};
+
+TEST_F(QPDrawPalette, RepeatedRecolorConvertsOnce) {
+    for (uint8_t i = 0; i < 5; ++i) {
+        ASSERT_TRUE(qp_drawimage_recolor(&host, i * 2, 0, gray, 10, 255, 255, 200, 255, 64));
+    }
+    EXPECT_EQ(converts, 1);
+    EXPECT_EQ(converted_entries, 16);
+}
+
+TEST_F(QPDrawPalette, AlternatingColorsUseTheCache) {
+    for (uint8_t i = 0; i < 6; ++i) {
+        ASSERT_TRUE(qp_drawimage_recolor(&host, 0, 0, gray, 20 + (i % 3) * 10, 255, 255, 201, 255, 64));
+    }
+#if QUANTUM_PAINTER_PALETTE_CACHE_SIZE >= 3
+    EXPECT_EQ(converts, 3);
+#else
+    EXPECT_EQ(converts, 6);
+#endif
+    EXPECT_EQ(host.framebuffer, Reference(24, gray, 40, 201));
+}
+
+TEST_F(QPDrawPalette, PalettesAreKeyedByDeviceFormat) {
+    ASSERT_TRUE(qp_drawimage_recolor(&host, 0, 0, gray, 50, 255, 255, 202, 255, 64));
+    ASSERT_TRUE(qp_drawimage_recolor(&other, 0, 0, gray, 50, 255, 255, 202, 255, 64));
+    ASSERT_TRUE(qp_drawimage_recolor(&host, 0, 0, gray, 50, 255, 255, 202, 255, 64));
+#if QUANTUM_PAINTER_PALETTE_CACHE_SIZE >= 2
+    EXPECT_EQ(converts, 2);
+#else
+    EXPECT_EQ(converts, 3);
+#endif
+    EXPECT_EQ(host.framebuffer, Reference(24, gray, 50, 202));
+    EXPECT_EQ(other.framebuffer, Reference(16, gray, 50, 202));
+}
+
+TEST_F(QPDrawPalette, AssetPaletteIsNeverReused) {
+    ASSERT_TRUE(qp_drawimage_recolor(&host, 0, 0, gray, 60, 255, 255, 203, 255, 64));
+    ASSERT_TRUE(qp_drawimage(&host, 0, 8, palette));
+    ASSERT_TRUE(qp_drawimage(&host, 0, 12, palette));
+    ASSERT_TRUE(qp_drawimage_recolor(&host, 0, 16, gray, 60, 255, 255, 203, 255, 64));
+
+    // The palette image converts its own palette each time it's drawn, and the interpolated one is then restored
+#if QUANTUM_PAINTER_PALETTE_CACHE_SIZE > 0
+    EXPECT_EQ(converts, 3);
+#else
+    EXPECT_EQ(converts, 4);
+#endif
+    EXPECT_EQ(memcmp(host.pixel(0, 0), host.pixel(0, 16), HOST_WIDTH * IMAGE_HEIGHT * 3), 0);
+    EXPECT_EQ(memcmp(host.pixel(0, 8), host.pixel(0, 12), HOST_WIDTH * IMAGE_HEIGHT * 3), 0);
+    const uint8_t *red = host.pixel(0, 8);
+    EXPECT_EQ(std::vector<uint8_t>(red, red + 3), std::vector<uint8_t>({255, 0, 0}));
+}
+
+TEST_F(QPDrawPalette, FillColorConvertsOnce) {
+    ASSERT_TRUE(qp_rect(&host, 0, 0, 31, 31, 70, 255, 255, true));
+    ASSERT_TRUE(qp_rect(&host, 2, 2, 10, 10, 70, 255, 255, false));
+    ASSERT_TRUE(qp_circle(&host, 16, 16, 6, 70, 255, 255, true));
+    EXPECT_EQ(converts, 1);
+
+    ASSERT_TRUE(qp_rect(&other, 0, 0, 31, 31, 70, 255, 255, true));
+    ASSERT_TRUE(qp_rect(&host, 0, 0, 31, 31, 85, 255, 255, true));
+    EXPECT_EQ(converts, 3);
+}
+
+TEST_F(QPDrawPalette, FillIsReplicatedAcrossTheBuffer) {
+    // Wider than a single viewport's worth of pixdata, for both formats
+    for (qp_test_host_t *device : {&host, &other}) {
+        ASSERT_TRUE(qp_rect(device, 0, 0, HOST_WIDTH - 1, HOST_HEIGHT - 1, 43, 255, 255, true));
+        ASSERT_TRUE(qp_rect(device, 3, 5, 29, 30, 170, 255, 255, true));
+
+        const uint8_t *outside = device->pixel(2, 5);
+        const uint8_t *inside  = device->pixel(3, 5);
+        for (uint16_t y = 0; y < HOST_HEIGHT; ++y) {
+            for (uint16_t x = 0; x < HOST_WIDTH; ++x) {
+                bool in_rect = x >= 3 && x <= 29 && y >= 5 && y <= 30;
+                ASSERT_EQ(memcmp(device->pixel(x, y), in_rect ? inside : outside, 3), 0) << "at " << x << "," << y;
+            }
+        }
+        EXPECT_NE(memcmp(inside, outside, 3), 0);
+    }
+}
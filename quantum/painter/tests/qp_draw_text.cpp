@@ -0,0 +1,261 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "qp_test_host.hpp"
+#include "qp_test_panel.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 32
+#define LINE_HEIGHT 8
+
+// Synthetic 1bpp font covering the ASCII table. Glyphs are 4 to 7 pixels wide, with a pattern unique to each code point.
+struct test_font {
+    uint8_t seed;
+
+    uint8_t width(char c) const {
+        return (c >= '0' && c <= '9') ? 5 : 4 + ((c + seed) % 4);
+    }
+
+    bool pixel(char c, uint8_t x, uint8_t y) const {
+        return ((x * 7 + y * 3 + c + seed) % 5) < 2;
+    }
+
+    std::vector<uint8_t> build() const {
+        std::vector<uint8_t>  glyphs;
+        std::vector<uint32_t> offsets;
+        for (char c = 0x20; c < 0x7F; ++c) {
+            offsets.push_back(glyphs.size());
+            uint8_t byte = 0, bit = 0;
+            for (uint8_t y = 0; y < LINE_HEIGHT; ++y) {
+                for (uint8_t x = 0; x < width(c); ++x) {
+                    byte |= (pixel(c, x, y) ? 1 : 0) << bit;
+                    if (++bit == 8) {
+                        glyphs.push_back(byte);
+                        byte = bit = 0;
+                    }
+                }
+            }
+            if (bit) {
+                glyphs.push_back(byte);
+            }
+        }
+
+        std::vector<uint8_t> out;
+        uint32_t total = 25 + 290 + 5 + glyphs.size();
+
+        // Font descriptor
+        qp_test_put_header(out, 0x00, 20);
+        qp_test_put(out, 0x464651, 3);
+        qp_test_put(out, 0x01, 1);
+        qp_test_put(out, total, 4);
+        qp_test_put(out, ~total, 4);
+        qp_test_put(out, LINE_HEIGHT, 1);
+        qp_test_put(out, 1, 1);    // has_ascii_table
+        qp_test_put(out, 0, 2);    // num_unicode_glyphs
+        qp_test_put(out, 0x00, 1); // GRAYSCALE_1BPP
+        qp_test_put(out, 0, 1);    // flags
+        qp_test_put(out, 0, 1);    // uncompressed
+        qp_test_put(out, 0, 1);    // transparency_index
+
+        // ASCII glyph table
+        qp_test_put_header(out, 0x01, 95 * 3);
+        for (char c = 0x20; c < 0x7F; ++c) {
+            qp_test_put(out, width(c) | (offsets[c - 0x20] << 6), 3);
+        }
+
+        // Glyph data
+        qp_test_put_header(out, 0x04, glyphs.size());
+        out.insert(out.end(), glyphs.begin(), glyphs.end());
+        return out;
+    }
+
+    uint16_t textwidth(const char *str) const {
+        uint16_t w = 0;
+        for (; *str; ++str) {
+            w += width(*str);
+        }
+        return w;
+    }
+
+    // Renders the string into the supplied image the same way the panel should end up, white on black
+    void render(std::vector<uint16_t> &image, uint16_t x, uint16_t y, const char *str) const {
+        for (; *str; ++str) {
+            for (uint8_t gy = 0; gy < LINE_HEIGHT; ++gy) {
+                for (uint8_t gx = 0; gx < width(*str); ++gx) {
+                    image[(y + gy) * PANEL_WIDTH + x + gx] = pixel(*str, gx, gy) ? 0xFFFF : 0x0000;
+                }
+            }
+            x += width(*str);
+        }
+    }
+};
+
+class QPDrawText : public ::testing::Test {
+   protected:
+    painter_driver_t      panel;
+    test_font             font_model = {0};
+    std::vector<uint8_t>  font_data;
+    painter_font_handle_t font;
+    std::vector<uint16_t> expected;
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_test_panel_init(&panel, PANEL_WIDTH, PANEL_HEIGHT));
+        expected.assign(PANEL_WIDTH * PANEL_HEIGHT, UNTOUCHED);
+
+        font_data = font_model.build();
+        font      = qp_load_font_mem(font_data.data());
+        ASSERT_NE(font, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+    }
+
+    void ExpectPanelMatches() {
+        EXPECT_EQ(recorder.image, expected);
+    }
+};
+
+TEST_F(QPDrawText, DrawTextMatchesFont) {
+    const char *text = "Hello, World! 0123 ~{}";
+    EXPECT_EQ(qp_drawtext(&panel, 3, 5, font, text), font_model.textwidth(text));
+    font_model.render(expected, 3, 5, text);
+    ExpectPanelMatches();
+
+    // Drawing again comes out the same, regardless of what's already cached
+    recorder.image.assign(PANEL_WIDTH * PANEL_HEIGHT, UNTOUCHED);
+    EXPECT_EQ(qp_drawtext(&panel, 3, 5, font, text), font_model.textwidth(text));
+    ExpectPanelMatches();
+}
+
+TEST_F(QPDrawText, LongTextMatchesFont) {
+    // More distinct glyphs than fit in the cache, or in a single span
+    const char *text = "abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    EXPECT_EQ(qp_drawtext(&panel, 0, 20, font, text), font_model.textwidth(text));
+    font_model.render(expected, 0, 20, text);
+    ExpectPanelMatches();
+}
+
+TEST_F(QPDrawText, CachedRunUsesSingleViewport) {
+    // Digits are all 5 pixels wide, which fits within the cache's per-glyph limit
+    const char *text = "0123456789";
+    ASSERT_EQ(qp_drawtext(&panel, 0, 0, font, text), 50);
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Each span is limited to as many glyphs as the cache can hold at once
+    EXPECT_EQ(recorder.viewports, (10 + QUANTUM_PAINTER_GLYPH_CACHE_SIZE - 1) / QUANTUM_PAINTER_GLYPH_CACHE_SIZE);
+#else
+    EXPECT_EQ(recorder.viewports, 10);
+#endif
+    font_model.render(expected, 0, 0, text);
+    ExpectPanelMatches();
+}
+
+TEST_F(QPDrawText, UpdateOnlySendsChangedGlyphs) {
+    ASSERT_EQ(qp_drawtext(&panel, 10, 10, font, "12:34"), font_model.textwidth("12:34"));
+    recorder.reset();
+
+    ASSERT_EQ(qp_drawtext_update(&panel, 10, 10, font, "12:34", "12:35"), font_model.textwidth("12:35"));
+    EXPECT_EQ(recorder.viewports, 1);
+    EXPECT_EQ(recorder.bytes, VIEWPORT_BYTES + 5 * LINE_HEIGHT * 2);
+    font_model.render(expected, 10, 10, "12:35");
+    ExpectPanelMatches();
+
+    // Two separate changes are separate runs
+    recorder.reset();
+    ASSERT_EQ(qp_drawtext_update(&panel, 10, 10, font, "12:35", "13:36"), font_model.textwidth("13:36"));
+    EXPECT_EQ(recorder.viewports, 2);
+    font_model.render(expected, 10, 10, "13:36");
+    ExpectPanelMatches();
+
+    // Nothing changed, nothing sent
+    recorder.reset();
+    ASSERT_EQ(qp_drawtext_update(&panel, 10, 10, font, "13:36", "13:36"), font_model.textwidth("13:36"));
+    EXPECT_EQ(recorder.bytes, 0);
+}
+
+TEST_F(QPDrawText, UpdateClearsLeftovers) {
+    ASSERT_GT(qp_drawtext(&panel, 0, 0, font, "Layer: Lower"), 0);
+    recorder.reset();
+
+    ASSERT_EQ(qp_drawtext_update(&panel, 0, 0, font, "Layer: Lower", "Layer: 0"), font_model.textwidth("Layer: 0"));
+    font_model.render(expected, 0, 0, "Layer: Lower");
+    for (uint16_t y = 0; y < LINE_HEIGHT; ++y) {
+        for (uint16_t x = font_model.textwidth("Layer: 0"); x < font_model.textwidth("Layer: Lower"); ++x) {
+            expected[y * PANEL_WIDTH + x] = 0x0000;
+        }
+    }
+    font_model.render(expected, 0, 0, "Layer: 0");
+    ExpectPanelMatches();
+}
+
+TEST_F(QPDrawText, UpdateHandlesShiftedGlyphs) {
+    // Changing the width of an early glyph moves everything after it
+    ASSERT_GT(qp_drawtext(&panel, 0, 0, font, "a:bcd"), 0);
+    ASSERT_GT(qp_drawtext_update(&panel, 0, 0, font, "a:bcd", "ab:bcd"), 0);
+    font_model.render(expected, 0, 0, "ab:bcd");
+    ExpectPanelMatches();
+
+    ASSERT_GT(qp_drawtext_update(&panel, 0, 0, font, "ab:bcd", "a:bcd"), 0);
+    font_model.render(expected, 0, 0, "a:bcd");
+    for (uint16_t y = 0; y < LINE_HEIGHT; ++y) {
+        for (uint16_t x = font_model.textwidth("a:bcd"); x < font_model.textwidth("ab:bcd"); ++x) {
+            expected[y * PANEL_WIDTH + x] = 0x0000;
+        }
+    }
+    ExpectPanelMatches();
+}
+
+TEST_F(QPDrawText, ReloadedFontIsNotStale) {
+    ASSERT_GT(qp_drawtext(&panel, 0, 0, font, "0123"), 0);
+    ASSERT_TRUE(qp_close_font(font));
+
+    // A different font loaded into the same slot must not reuse the old glyphs
+    test_font            other_model = {1};
+    std::vector<uint8_t> other_data  = other_model.build();
+    font                             = qp_load_font_mem(other_data.data());
+    ASSERT_NE(font, nullptr);
+    ASSERT_GT(qp_drawtext(&panel, 0, 0, font, "0123"), 0);
+    other_model.render(expected, 0, 0, "0123");
+    ExpectPanelMatches();
+    ASSERT_TRUE(qp_close_font(font));
+
+    // Swap back to the fixture's font for teardown
+    font = qp_load_font_mem(font_data.data());
+    ASSERT_NE(font, nullptr);
+}
+
+// Run with --gtest_also_run_disabled_tests to compare redrawing text in full against updating it
+TEST_F(QPDrawText, DISABLED_Benchmark) {
+    using clock = std::chrono::steady_clock;
+
+    static const char *frames[] = {"CPU 41% 12:34:56", "CPU 42% 12:34:57", "CPU 42% 12:34:58", "CPU 40% 12:34:59"};
+    const uint32_t     loops    = 2000;
+    recorder.replay             = false;
+
+    auto run = [&](bool update) {
+        recorder.reset();
+        auto start = clock::now();
+        for (uint32_t i = 0; i < loops; ++i) {
+            const char *prev = frames[i % 4];
+            const char *str  = frames[(i + 1) % 4];
+            if (update) {
+                qp_drawtext_update(&panel, 0, 0, font, prev, str);
+            } else {
+                qp_drawtext(&panel, 0, 0, font, str);
+            }
+        }
+        double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / loops;
+        std::cout << std::left << std::setw(24) << (update ? "qp_drawtext_update" : "qp_drawtext") << std::right << std::fixed << std::setprecision(0) << std::setw(12) << ns << std::setw(12) << (double)recorder.bytes / loops << std::setw(12) << (double)recorder.viewports / loops << std::endl;
+    };
+
+    std::cout << "glyph cache: " << QUANTUM_PAINTER_GLYPH_CACHE_SIZE << " entries" << std::endl;
+    std::cout << std::left << std::setw(24) << "call" << std::right << std::setw(12) << "ns/call" << std::setw(12) << "bytes/call" << std::setw(12) << "viewports" << std::endl;
+    run(false);
+    run(true);
+}
@@ -0,0 +1,327 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "qp_test_host.hpp"
+#include "qp_test_panel.hpp"
+
+#include <algorithm>
+#include <string>
+
+extern "C" {
+#include "flash.h"
+#include "flash_file_mock.h"
+}
+
+#define PANEL_WIDTH 64
+#define PANEL_HEIGHT 32
+#define IMAGE_WIDTH 48
+#define IMAGE_HEIGHT 12
+#define LINE_HEIGHT 8
+#define REPORT_SIZE 32
+
+static uint32_t updated_count = 0;
+
+// The panel shares its bus with the flash, as an SPI display and SPI flash on the same SPI driver would
+static bool shared_bus_start(painter_device_t device) {
+    if (flash_file_mock_bus_claimed) {
+        return false;
+    }
+    flash_file_mock_bus_claimed = true;
+    return recorder_start(device);
+}
+
+static void shared_bus_stop(painter_device_t device) {
+    recorder_stop(device);
+    flash_file_mock_bus_claimed = false;
+}
+
+static painter_comms_with_command_vtable_t shared_bus_comms_vtable;
+
+extern "C" void qp_flash_assets_updated_user(void) {
+    updated_count++;
+}
+
+// Builds a single-frame, uncompressed 4bpp grayscale QGF
+static std::vector<uint8_t> build_image(void) {
+    std::vector<uint8_t> out;
+    qp_test_put_header(out, 0x00, 18);
+    qp_test_put(out, 0x464751, 3);
+    qp_test_put(out, 0x01, 1);
+    qp_test_put(out, 0, 8);
+    qp_test_put(out, IMAGE_WIDTH, 2);
+    qp_test_put(out, IMAGE_HEIGHT, 2);
+    qp_test_put(out, 1, 2);
+
+    qp_test_put_header(out, 0x01, 4);
+    qp_test_put(out, out.size() + 4, 4);
+
+    qp_test_put_header(out, 0x02, 6);
+    qp_test_put(out, 0x02, 1); // GRAYSCALE_4BPP
+    qp_test_put(out, 0, 5);
+
+    qp_test_put_header(out, 0x05, IMAGE_WIDTH * IMAGE_HEIGHT / 2);
+    for (uint16_t y = 0; y < IMAGE_HEIGHT; ++y) {
+        for (uint16_t x = 0; x < IMAGE_WIDTH; x += 2) {
+            qp_test_put(out, ((x * 3 + y) % 16) | (((x * 5 + y * 7) % 16) << 4), 1);
+        }
+    }
+
+    qp_test_patch_total(out, 9);
+    return out;
+}
+
+// Builds a 1bpp QFF covering the ASCII table, with 8-pixel wide glyphs
+static std::vector<uint8_t> build_font(void) {
+    std::vector<uint8_t>  glyphs;
+    std::vector<uint32_t> offsets;
+    for (char c = 0x20; c < 0x7F; ++c) {
+        offsets.push_back(glyphs.size());
+        for (uint8_t y = 0; y < LINE_HEIGHT; ++y) {
+            qp_test_put(glyphs, (c * 13 + y * 7) & 0xFF, 1); // one byte per row
+        }
+    }
+
+    std::vector<uint8_t> out;
+    qp_test_put_header(out, 0x00, 20);
+    qp_test_put(out, 0x464651, 3);
+    qp_test_put(out, 0x01, 1);
+    qp_test_put(out, 0, 8);
+    qp_test_put(out, LINE_HEIGHT, 1);
+    qp_test_put(out, 1, 1); // has_ascii_table
+    qp_test_put(out, 0, 2); // num_unicode_glyphs
+    qp_test_put(out, 0, 4); // GRAYSCALE_1BPP, flags, uncompressed, transparency_index
+
+    qp_test_put_header(out, 0x01, 95 * 3);
+    for (char c = 0x20; c < 0x7F; ++c) {
+        qp_test_put(out, 8 | (offsets[c - 0x20] << 6), 3);
+    }
+
+    qp_test_put_header(out, 0x04, glyphs.size());
+    out.insert(out.end(), glyphs.begin(), glyphs.end());
+
+    qp_test_patch_total(out, 9);
+    return out;
+}
+
+struct test_asset {
+    std::string          name;
+    std::vector<uint8_t> data;
+};
+
+// Builds an asset directory, as per `qmk painter-pack-assets`
+static std::vector<uint8_t> build_directory(const std::vector<test_asset> &assets) {
+    std::vector<uint8_t> out;
+    qp_test_put(out, 0x415051, 3);
+    qp_test_put(out, 0x01, 1);
+    qp_test_put(out, assets.size(), 2);
+    qp_test_put(out, (uint16_t)~assets.size(), 2);
+    qp_test_put(out, 0, 8);
+
+    uint32_t offset = 16 + assets.size() * 24;
+    for (const test_asset &asset : assets) {
+        std::string name = asset.name;
+        name.resize(16, '\0');
+        out.insert(out.end(), name.begin(), name.end());
+        qp_test_put(out, offset, 4);
+        qp_test_put(out, asset.data.size(), 4);
+        offset += asset.data.size();
+    }
+    for (const test_asset &asset : assets) {
+        out.insert(out.end(), asset.data.begin(), asset.data.end());
+    }
+
+    qp_test_patch_total(out, 8);
+    return out;
+}
+
+class QPFlashAssets : public ::testing::Test {
+   protected:
+    painter_driver_t     panel;
+    std::vector<uint8_t> image_data = build_image();
+    std::vector<uint8_t> font_data  = build_font();
+
+    void SetUp() override {
+        shared_bus_comms_vtable                  = recorder_comms_vtable;
+        shared_bus_comms_vtable.base.comms_start = shared_bus_start;
+        shared_bus_comms_vtable.base.comms_stop  = shared_bus_stop;
+
+        ASSERT_TRUE(qp_test_panel_init(&panel, PANEL_WIDTH, PANEL_HEIGHT));
+        panel.comms_vtable = (const painter_comms_vtable_t *)&shared_bus_comms_vtable;
+        flash_file_mock_open(NULL);
+        updated_count = 0;
+    }
+
+    void TearDown() override {
+        flash_file_mock_close();
+    }
+
+    // Sends a single report to the updater, returning the response status
+    int8_t command(std::vector<uint8_t> &report) {
+        report.resize(REPORT_SIZE, 0);
+        EXPECT_TRUE(qp_flash_assets_raw_hid_receive(report.data(), report.size()));
+        return (int8_t)report[2];
+    }
+
+    int8_t command(uint8_t cmd, uint32_t offset = 0, const uint8_t *data = nullptr, uint8_t count = 0) {
+        std::vector<uint8_t> report = {QUANTUM_PAINTER_FLASH_ASSETS_RAW_HID_ID, cmd};
+        qp_test_put(report, offset, 4);
+        qp_test_put(report, count, 1);
+        if (data) {
+            report.insert(report.end(), data, data + count);
+        }
+        return command(report);
+    }
+
+    // Uploads the supplied data the same way the host updater does
+    void upload(const std::vector<uint8_t> &data) {
+        for (uint32_t offset = 0; offset < data.size(); offset += EXTERNAL_FLASH_SECTOR_SIZE) {
+            ASSERT_EQ(command(QP_FLASH_ASSETS_COMMAND_ERASE, offset), FLASH_STATUS_SUCCESS);
+        }
+        for (uint32_t offset = 0; offset < data.size(); offset += REPORT_SIZE - 7) {
+            uint8_t count = std::min<size_t>(REPORT_SIZE - 7, data.size() - offset);
+            ASSERT_EQ(command(QP_FLASH_ASSETS_COMMAND_WRITE, offset, &data[offset], count), FLASH_STATUS_SUCCESS);
+        }
+    }
+
+    void upload_assets(void) {
+        upload(build_directory({{"logo", image_data}, {"clock_font", font_data}}));
+        ASSERT_EQ(command(QP_FLASH_ASSETS_COMMAND_COMMIT), FLASH_STATUS_SUCCESS);
+    }
+};
+
+TEST_F(QPFlashAssets, UpdaterReportsRegion) {
+    std::vector<uint8_t> report = {QUANTUM_PAINTER_FLASH_ASSETS_RAW_HID_ID, QP_FLASH_ASSETS_COMMAND_INFO};
+    ASSERT_EQ(command(report), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(report[0], QUANTUM_PAINTER_FLASH_ASSETS_RAW_HID_ID);
+    EXPECT_EQ(report[1], QP_FLASH_ASSETS_COMMAND_INFO);
+    EXPECT_EQ(report[3] | (report[4] << 8) | (report[5] << 16) | (report[6] << 24), EXTERNAL_FLASH_SIZE - QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS);
+    EXPECT_EQ(report[7] | (report[8] << 8) | (report[9] << 16) | (report[10] << 24), EXTERNAL_FLASH_SECTOR_SIZE);
+
+    // Anything else is left for the keymap to handle
+    std::vector<uint8_t> other(REPORT_SIZE, 0x02);
+    EXPECT_FALSE(qp_flash_assets_raw_hid_receive(other.data(), other.size()));
+}
+
+TEST_F(QPFlashAssets, UpdaterRoundTrip) {
+    upload_assets();
+    EXPECT_EQ(updated_count, 1);
+
+    std::vector<uint8_t> directory = build_directory({{"logo", image_data}, {"clock_font", font_data}});
+    std::vector<uint8_t> readback;
+    for (uint32_t offset = 0; offset < directory.size(); offset += REPORT_SIZE - 3) {
+        uint8_t              count  = std::min<size_t>(REPORT_SIZE - 3, directory.size() - offset);
+        std::vector<uint8_t> report = {QUANTUM_PAINTER_FLASH_ASSETS_RAW_HID_ID, QP_FLASH_ASSETS_COMMAND_READ};
+        qp_test_put(report, offset, 4);
+        qp_test_put(report, count, 1);
+        ASSERT_EQ(command(report), FLASH_STATUS_SUCCESS);
+        readback.insert(readback.end(), &report[3], &report[3 + count]);
+    }
+    EXPECT_EQ(readback, directory);
+
+    // Nothing is allowed outside the asset region
+    uint8_t data[4] = {0};
+    EXPECT_EQ(command(QP_FLASH_ASSETS_COMMAND_WRITE, EXTERNAL_FLASH_SIZE - QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS - 2, data, sizeof(data)), FLASH_STATUS_BAD_ADDRESS);
+    EXPECT_EQ(command(QP_FLASH_ASSETS_COMMAND_ERASE, EXTERNAL_FLASH_SECTOR_SIZE / 2), FLASH_STATUS_BAD_ADDRESS);
+}
+
+TEST_F(QPFlashAssets, FindsAssetsByName) {
+    upload_assets();
+
+    uint32_t address, length;
+    ASSERT_TRUE(qp_flash_assets_find("clock_font", &address, &length));
+    EXPECT_EQ(address, QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS + 16 + 2 * 24 + image_data.size());
+    EXPECT_EQ(length, font_data.size());
+
+    EXPECT_FALSE(qp_flash_assets_find("clock", &address, &length));
+    EXPECT_FALSE(qp_flash_assets_find("a_name_longer_than_16", &address, &length));
+}
+
+TEST_F(QPFlashAssets, ImageMatchesMemory) {
+    upload_assets();
+
+    painter_image_handle_t flash_image = qp_load_image_flash("logo");
+    painter_image_handle_t mem_image   = qp_load_image_mem(image_data.data());
+    ASSERT_NE(flash_image, nullptr);
+    ASSERT_NE(mem_image, nullptr);
+    EXPECT_EQ(flash_image->width, IMAGE_WIDTH);
+    EXPECT_EQ(flash_image->height, IMAGE_HEIGHT);
+
+    flash_file_mock_stats = {};
+    ASSERT_TRUE(qp_drawimage(&panel, 0, 0, flash_image));
+
+    // Pixel data is read ahead in cache-sized chunks, rather than a byte at a time
+    EXPECT_LE(flash_file_mock_stats.reads, 2 + image_data.size() / QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE);
+
+    std::vector<uint16_t> flash_pixels = recorder.image;
+    recorder.image.assign(PANEL_WIDTH * PANEL_HEIGHT, UNTOUCHED);
+    ASSERT_TRUE(qp_drawimage(&panel, 0, 0, mem_image));
+    EXPECT_EQ(recorder.image, flash_pixels);
+    EXPECT_EQ(std::count(flash_pixels.begin(), flash_pixels.end(), UNTOUCHED), PANEL_WIDTH * PANEL_HEIGHT - IMAGE_WIDTH * IMAGE_HEIGHT);
+
+    EXPECT_TRUE(qp_close_image(flash_image));
+    EXPECT_TRUE(qp_close_image(mem_image));
+}
+
+TEST_F(QPFlashAssets, FontMatchesMemory) {
+    upload_assets();
+
+    painter_font_handle_t flash_font = qp_load_font_flash("clock_font");
+    painter_font_handle_t mem_font   = qp_load_font_mem(font_data.data());
+    ASSERT_NE(flash_font, nullptr);
+    ASSERT_NE(mem_font, nullptr);
+
+    const char *text = "12:34 Layer ~";
+    ASSERT_EQ(qp_drawtext(&panel, 1, 2, flash_font, text), 8 * strlen(text));
+    std::vector<uint16_t> flash_pixels = recorder.image;
+    recorder.image.assign(PANEL_WIDTH * PANEL_HEIGHT, UNTOUCHED);
+    ASSERT_EQ(qp_drawtext(&panel, 1, 2, mem_font, text), 8 * strlen(text));
+    EXPECT_EQ(recorder.image, flash_pixels);
+
+    EXPECT_TRUE(qp_close_font(flash_font));
+    EXPECT_TRUE(qp_close_font(mem_font));
+}
+
+TEST_F(QPFlashAssets, InvalidDirectoryIsRejected) {
+    // Nothing written yet, the flash is erased
+    EXPECT_EQ(command(QP_FLASH_ASSETS_COMMAND_COMMIT), FLASH_STATUS_ERROR);
+    EXPECT_EQ(qp_load_image_flash("logo"), nullptr);
+    EXPECT_EQ(updated_count, 0);
+
+    // Corrupt entry count
+    std::vector<uint8_t> directory = build_directory({{"logo", image_data}});
+    directory[6] ^= 0x01;
+    upload(directory);
+    EXPECT_EQ(command(QP_FLASH_ASSETS_COMMAND_COMMIT), FLASH_STATUS_ERROR);
+    EXPECT_EQ(qp_load_image_flash("logo"), nullptr);
+
+    // Entry shorter than the image it holds
+    std::vector<uint8_t> truncated(image_data.begin(), image_data.end() - 1);
+    upload(build_directory({{"logo", truncated}}));
+    EXPECT_EQ(command(QP_FLASH_ASSETS_COMMAND_COMMIT), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(qp_load_image_flash("logo"), nullptr);
+}
+
+TEST_F(QPFlashAssets, DisplayReleasesTheSharedBusForFlashReads) {
+    upload_assets();
+
+    painter_image_handle_t image = qp_load_image_flash("logo");
+    painter_font_handle_t  font  = qp_load_font_flash("clock_font");
+    ASSERT_NE(image, nullptr);
+    ASSERT_NE(font, nullptr);
+
+    flash_file_mock_stats = {};
+    recorder.reset();
+    ASSERT_TRUE(qp_drawimage(&panel, 0, 0, image));
+    ASSERT_EQ(qp_drawtext(&panel, 0, IMAGE_HEIGHT, font, "QMK"), 8 * 3);
+
+    // Every flash read happened with the display's comms stopped, and they were restarted afterwards
+    EXPECT_GT(flash_file_mock_stats.reads, 0);
+    EXPECT_EQ(flash_file_mock_stats.bus_conflicts, 0);
+    EXPECT_GT(recorder.starts, flash_file_mock_stats.reads);
+    EXPECT_FALSE(flash_file_mock_bus_claimed);
+
+    EXPECT_TRUE(qp_close_image(image));
+    EXPECT_TRUE(qp_close_font(font));
+}
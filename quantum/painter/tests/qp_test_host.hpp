@@ -0,0 +1,252 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+extern "C" {
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_tft_panel.h"
+}
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Opcodes sent by the host driver, so the recording comms can tell viewports apart from pixel data
+#define QP_TEST_HOST_OPCODE_SET_WINDOW 0x01
+#define QP_TEST_HOST_OPCODE_WRITE_PIXELS 0x02
+
+// Each viewport is two commands plus an 8-byte window
+#define QP_TEST_HOST_VIEWPORT_BYTES (1 + 8 + 1)
+
+// Traffic seen by the recording comms driver
+struct qp_test_host_stats_t {
+    uint32_t starts;
+    uint32_t commands;
+    uint32_t viewports;
+    uint32_t bytes;
+};
+
+// Host-side painter device, rendering into an in-memory RGB888 framebuffer. Pixel data arrives in the panel's native
+// format -- 16bpp (byte-swapped RGB565, as sent to most SPI panels) or 24bpp (RGB888) -- and is expanded as it's
+// written. Only QP_ROTATION_0 is supported.
+struct qp_test_host_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    qp_test_host_stats_t stats;
+    uint8_t              command;
+    uint16_t             l, t, r, b, x, y;
+    std::vector<uint8_t> framebuffer; // RGB888, row-major
+
+    const uint8_t *pixel(uint16_t px, uint16_t py) const {
+        return &framebuffer[(py * base.panel_width + px) * 3];
+    }
+
+    // 32-bit FNV-1a hash of the framebuffer, used for golden-image comparisons
+    uint32_t hash() const {
+        uint32_t h = 0x811C9DC5;
+        for (uint8_t c : framebuffer) {
+            h = (h ^ c) * 0x01000193;
+        }
+        return h;
+    }
+
+    // Writes the framebuffer out as a binary PPM
+    bool dump(const char *path) const {
+        FILE *f = fopen(path, "wb");
+        if (!f) {
+            return false;
+        }
+        fprintf(f, "P6\n%d %d\n255\n", (int)base.panel_width, (int)base.panel_height);
+        bool ok = fwrite(framebuffer.data(), 1, framebuffer.size(), f) == framebuffer.size();
+        fclose(f);
+        return ok;
+    }
+
+    // Dumps the framebuffer as <name>.ppm, if QP_TEST_DUMP_DIR is set in the environment
+    void dump_if_requested(const std::string &name) const {
+        const char *dir = getenv("QP_TEST_DUMP_DIR");
+        if (dir) {
+            dump((std::string(dir) + "/" + name + ".ppm").c_str());
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Recording comms
+
+static bool qp_test_host_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool qp_test_host_comms_start(painter_device_t device) {
+    ((qp_test_host_t *)device)->stats.starts++;
+    return true;
+}
+
+static void qp_test_host_comms_stop(painter_device_t device) {}
+
+static uint32_t qp_test_host_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    ((qp_test_host_t *)device)->stats.bytes += byte_count;
+    return byte_count;
+}
+
+static bool qp_test_host_comms_send_command(painter_device_t device, uint8_t cmd) {
+    qp_test_host_t *host = (qp_test_host_t *)device;
+    host->command        = cmd;
+    host->stats.commands++;
+    host->stats.bytes++;
+    if (cmd == QP_TEST_HOST_OPCODE_SET_WINDOW) {
+        host->stats.viewports++;
+    }
+    return true;
+}
+
+static const painter_comms_with_command_vtable_t qp_test_host_comms_vtable = {
+    .base =
+        {
+            .comms_init  = qp_test_host_comms_init,
+            .comms_start = qp_test_host_comms_start,
+            .comms_stop  = qp_test_host_comms_stop,
+            .comms_send  = qp_test_host_comms_send,
+        },
+    .send_command = qp_test_host_comms_send_command,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Driver
+
+static bool qp_test_host_init(painter_device_t device, painter_rotation_t rotation) {
+    return rotation == QP_ROTATION_0;
+}
+
+static bool qp_test_host_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool qp_test_host_clear(painter_device_t device) {
+    qp_test_host_t *host = (qp_test_host_t *)device;
+    std::fill(host->framebuffer.begin(), host->framebuffer.end(), 0);
+    return true;
+}
+
+static bool qp_test_host_flush(painter_device_t device) {
+    return true;
+}
+
+static bool qp_test_host_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    qp_test_host_t *host = (qp_test_host_t *)device;
+    if (left > right || top > bottom || right >= host->base.panel_width || bottom >= host->base.panel_height) {
+        return false;
+    }
+
+    uint8_t window[8] = {(uint8_t)(left >> 8), (uint8_t)left, (uint8_t)(top >> 8), (uint8_t)top, (uint8_t)(right >> 8), (uint8_t)right, (uint8_t)(bottom >> 8), (uint8_t)bottom};
+    qp_comms_command(device, QP_TEST_HOST_OPCODE_SET_WINDOW);
+    qp_comms_send(device, window, sizeof(window));
+    qp_comms_command(device, QP_TEST_HOST_OPCODE_WRITE_PIXELS);
+
+    host->l = host->x = left;
+    host->t = host->y = top;
+    host->r           = right;
+    host->b           = bottom;
+    return true;
+}
+
+static bool qp_test_host_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    qp_test_host_t *host  = (qp_test_host_t *)device;
+    const uint8_t * p     = (const uint8_t *)pixel_data;
+    uint8_t         bytes = host->base.native_bits_per_pixel / 8;
+    qp_comms_send(device, pixel_data, native_pixel_count * bytes);
+
+    for (uint32_t i = 0; i < native_pixel_count; ++i, p += bytes) {
+        uint8_t *out = &host->framebuffer[(host->y * host->base.panel_width + host->x) * 3];
+        if (bytes == 3) {
+            memcpy(out, p, 3);
+        } else {
+            // Big-endian RGB565, expanded by replicating the high bits
+            uint16_t rgb565 = (p[0] << 8) | p[1];
+            out[0]          = ((rgb565 >> 8) & 0xF8) | (rgb565 >> 13);
+            out[1]          = ((rgb565 >> 3) & 0xFC) | ((rgb565 >> 9) & 0x03);
+            out[2]          = ((rgb565 << 3) & 0xF8) | ((rgb565 >> 2) & 0x07);
+        }
+
+        if (++host->x > host->r) {
+            host->x = host->l;
+            if (++host->y > host->b) {
+                host->y = host->t;
+            }
+        }
+    }
+    return true;
+}
+
+static const painter_driver_vtable_t qp_test_host_rgb565_vtable = {
+    .init            = qp_test_host_init,
+    .power           = qp_test_host_power,
+    .clear           = qp_test_host_clear,
+    .flush           = qp_test_host_flush,
+    .viewport        = qp_test_host_viewport,
+    .pixdata         = qp_test_host_pixdata,
+    .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
+    .append_pixels   = qp_tft_panel_append_pixels_rgb565,
+    .append_pixdata  = qp_tft_panel_append_pixdata,
+};
+
+static const painter_driver_vtable_t qp_test_host_rgb888_vtable = {
+    .init            = qp_test_host_init,
+    .power           = qp_test_host_power,
+    .clear           = qp_test_host_clear,
+    .flush           = qp_test_host_flush,
+    .viewport        = qp_test_host_viewport,
+    .pixdata         = qp_test_host_pixdata,
+    .palette_convert = qp_tft_panel_palette_convert_rgb888,
+    .append_pixels   = qp_tft_panel_append_pixels_rgb888,
+    .append_pixdata  = qp_tft_panel_append_pixdata,
+};
+
+// Sets up a host device of the supplied size and native bpp (16 or 24), with a black framebuffer and cleared stats
+static inline bool qp_test_host_make(qp_test_host_t *host, uint16_t width, uint16_t height, uint8_t native_bits_per_pixel) {
+    memset(&host->base, 0, sizeof(host->base));
+    host->base.driver_vtable         = native_bits_per_pixel == 24 ? &qp_test_host_rgb888_vtable : &qp_test_host_rgb565_vtable;
+    host->base.comms_vtable          = (const painter_comms_vtable_t *)&qp_test_host_comms_vtable;
+    host->base.panel_width           = width;
+    host->base.panel_height          = height;
+    host->base.native_bits_per_pixel = native_bits_per_pixel;
+
+    host->framebuffer.assign(width * height * 3, 0);
+    if (!qp_init((painter_device_t)host, QP_ROTATION_0)) {
+        return false;
+    }
+    host->stats = {};
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Test assets
+
+// Appends the value to a QGF/QFF being built, little-endian and zero-padded out to `bytes` bytes
+static inline void qp_test_put(std::vector<uint8_t> &out, uint32_t value, uint8_t bytes) {
+    for (uint8_t i = 0; i < bytes; ++i) {
+        out.push_back(i < sizeof(value) ? (value >> (i * 8)) & 0xFF : 0);
+    }
+}
+
+// Appends a block header -- the type ID, its complement, and the 24-bit length of the block that follows
+static inline void qp_test_put_header(std::vector<uint8_t> &out, uint8_t type_id, uint32_t length) {
+    qp_test_put(out, type_id, 1);
+    qp_test_put(out, (uint8_t)~type_id, 1);
+    qp_test_put(out, length, 3);
+}
+
+// Patches the finished asset's total size and its complement into the descriptor, at the supplied offset
+static inline void qp_test_patch_total(std::vector<uint8_t> &out, size_t pos) {
+    uint32_t total = out.size();
+    for (uint8_t k = 0; k < 4; ++k) {
+        out[pos + k]     = (total >> (k * 8)) & 0xFF;
+        out[pos + 4 + k] = (~total >> (k * 8)) & 0xFF;
+    }
+}
@@ -0,0 +1,160 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+extern "C" {
+#include "qp_internal.h"
+#include "qp_tft_panel.h"
+}
+
+#include <cstring>
+#include <vector>
+
+#define OPCODE_SET_COLUMN_ADDRESS 0x2A
+#define OPCODE_SET_ROW_ADDRESS 0x2B
+#define OPCODE_ENABLE_WRITES 0x2C
+
+// Each viewport is three commands plus two 4-byte windows
+#define VIEWPORT_BYTES (3 + 4 + 4)
+
+// Anything the panel hasn't been sent yet
+#define UNTOUCHED 0x1234
+
+// Records everything sent to a fake RGB565 panel, and replays it into a panel-sized image
+struct comms_recorder {
+    bool                  replay;
+    uint16_t              width;
+    uint32_t              starts;
+    uint32_t              bytes;
+    uint32_t              viewports;
+    uint8_t               command;
+    std::vector<uint8_t>  window;
+    uint16_t              l, t, r, b, x, y;
+    std::vector<uint16_t> image;
+
+    void reset() {
+        starts    = 0;
+        bytes     = 0;
+        viewports = 0;
+    }
+};
+
+static comms_recorder recorder;
+
+static bool recorder_init(painter_device_t device) {
+    return true;
+}
+
+static bool recorder_start(painter_device_t device) {
+    recorder.starts++;
+    return true;
+}
+
+static void recorder_stop(painter_device_t device) {}
+
+static uint32_t recorder_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    const uint8_t *p = (const uint8_t *)data;
+    recorder.bytes += byte_count;
+
+    if (recorder.command != OPCODE_ENABLE_WRITES) {
+        recorder.window.insert(recorder.window.end(), p, p + byte_count);
+        if (recorder.window.size() == 4) {
+            uint16_t start = (recorder.window[0] << 8) | recorder.window[1];
+            uint16_t end   = (recorder.window[2] << 8) | recorder.window[3];
+            if (recorder.command == OPCODE_SET_COLUMN_ADDRESS) {
+                recorder.l = start;
+                recorder.r = end;
+            } else {
+                recorder.t = start;
+                recorder.b = end;
+            }
+        }
+        return byte_count;
+    }
+
+    if (!recorder.replay) {
+        return byte_count;
+    }
+
+    for (uint32_t i = 0; i + 1 < byte_count; i += 2) {
+        uint16_t pixel;
+        memcpy(&pixel, &p[i], sizeof(pixel));
+        recorder.image[recorder.y * recorder.width + recorder.x] = pixel;
+        if (++recorder.x > recorder.r) {
+            recorder.x = recorder.l;
+            if (++recorder.y > recorder.b) {
+                recorder.y = recorder.t;
+            }
+        }
+    }
+    return byte_count;
+}
+
+static bool recorder_send_command(painter_device_t device, uint8_t cmd) {
+    recorder.bytes += 1;
+    recorder.command = cmd;
+    recorder.window.clear();
+    if (cmd == OPCODE_ENABLE_WRITES) {
+        recorder.viewports++;
+        recorder.x = recorder.l;
+        recorder.y = recorder.t;
+    }
+    return true;
+}
+
+static const painter_comms_with_command_vtable_t recorder_comms_vtable = {
+    .base =
+        {
+            .comms_init  = recorder_init,
+            .comms_start = recorder_start,
+            .comms_stop  = recorder_stop,
+            .comms_send  = recorder_send,
+        },
+    .send_command = recorder_send_command,
+};
+
+static bool panel_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static const tft_panel_dc_reset_painter_driver_vtable_t panel_vtable = {
+    .base =
+        {
+            .init            = panel_init,
+            .power           = qp_tft_panel_power,
+            .clear           = qp_tft_panel_clear,
+            .flush           = qp_tft_panel_flush,
+            .viewport        = qp_tft_panel_viewport,
+            .pixdata         = qp_tft_panel_pixdata,
+            .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
+            .append_pixels   = qp_tft_panel_append_pixels_rgb565,
+            .append_pixdata  = qp_tft_panel_append_pixdata,
+        },
+    .num_window_bytes   = 2,
+    .swap_window_coords = false,
+    .opcodes =
+        {
+            .display_on         = 0x29,
+            .display_off        = 0x28,
+            .set_column_address = OPCODE_SET_COLUMN_ADDRESS,
+            .set_row_address    = OPCODE_SET_ROW_ADDRESS,
+            .enable_writes      = OPCODE_ENABLE_WRITES,
+        },
+};
+
+// Sets up a recording panel of the supplied size, with every pixel untouched
+static bool qp_test_panel_init(painter_driver_t *panel, uint16_t width, uint16_t height) {
+    memset(panel, 0, sizeof(*panel));
+    panel->driver_vtable         = (const painter_driver_vtable_t *)&panel_vtable;
+    panel->comms_vtable          = (const painter_comms_vtable_t *)&recorder_comms_vtable;
+    panel->panel_width           = width;
+    panel->panel_height          = height;
+    panel->native_bits_per_pixel = 16;
+
+    recorder.replay = true;
+    recorder.width  = width;
+    recorder.image.assign(width * height, UNTOUCHED);
+    recorder.reset();
+    return qp_init(panel, QP_ROTATION_0);
+}
@@ -0,0 +1,93 @@
+QP_COMMON_DEFS := -DQUANTUM_PAINTER_ENABLE
+
+QP_COMMON_SRC := \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c
+
+QP_COMMON_INC := \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/comms \
+	$(DRIVER_PATH)/painter/tft_panel
+
+qp_draw_text_DEFS := $(QP_COMMON_DEFS)
+qp_draw_text_SRC := $(QUANTUM_PATH)/painter/tests/qp_draw_text.cpp $(QP_COMMON_SRC)
+qp_draw_text_INC := $(QP_COMMON_INC)
+
+qp_draw_text_glyph_cache_DEFS := $(QP_COMMON_DEFS) \
+	-DQUANTUM_PAINTER_GLYPH_CACHE_SIZE=8 \
+	-DQUANTUM_PAINTER_GLYPH_CACHE_GLYPH_BYTES=6
+qp_draw_text_glyph_cache_SRC := $(QUANTUM_PATH)/painter/tests/qp_draw_text.cpp $(QP_COMMON_SRC)
+qp_draw_text_glyph_cache_INC := $(QP_COMMON_INC)
+
+qp_draw_image_DEFS := $(QP_COMMON_DEFS) \
+	-DQUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION=1
+qp_draw_image_SRC := $(QUANTUM_PATH)/painter/tests/qp_draw_image.cpp $(QP_COMMON_SRC) \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+qp_draw_image_INC := $(QP_COMMON_INC)
+
+qp_draw_palette_DEFS := $(QP_COMMON_DEFS)
+qp_draw_palette_SRC := $(QUANTUM_PATH)/painter/tests/qp_draw_palette.cpp $(QP_COMMON_SRC) \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+qp_draw_palette_INC := $(QP_COMMON_INC)
+
+qp_draw_palette_cache_DEFS := $(QP_COMMON_DEFS) \
+	-DQUANTUM_PAINTER_PALETTE_CACHE_SIZE=4
+qp_draw_palette_cache_SRC := $(qp_draw_palette_SRC)
+qp_draw_palette_cache_INC := $(qp_draw_palette_INC)
+
+qp_flash_assets_DEFS := $(QP_COMMON_DEFS) \
+	-DQUANTUM_PAINTER_FLASH_ASSETS_ENABLE \
+	-DQUANTUM_PAINTER_FLASH_ASSETS_ADDRESS=8192 \
+	-DEXTERNAL_FLASH_SIZE=65536 \
+	-DEXTERNAL_FLASH_SECTOR_SIZE=4096
+qp_flash_assets_SRC := $(QUANTUM_PATH)/painter/tests/qp_flash_assets.cpp $(QP_COMMON_SRC) \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_flash_assets.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/flash_file_mock.c
+qp_flash_assets_INC := $(QP_COMMON_INC) \
+	$(DRIVER_PATH)/flash
+
+qp_flash_assets_fonts_to_ram_DEFS := $(qp_flash_assets_DEFS) \
+	-DQUANTUM_PAINTER_LOAD_FONTS_TO_RAM=1
+qp_flash_assets_fonts_to_ram_SRC := $(qp_flash_assets_SRC)
+qp_flash_assets_fonts_to_ram_INC := $(qp_flash_assets_INC)
+
+qp_draw_golden_DEFS := $(QP_COMMON_DEFS) \
+	-DQUANTUM_PAINTER_SURFACE_ENABLE \
+	-DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE \
+	-DQUANTUM_PAINTER_SUPPORTS_256_PALETTE=1 \
+	-DQUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS=1 \
+	-DQUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION=1 \
+	-DQUANTUM_PAINTER_NUM_IMAGES=32
+qp_draw_golden_SRC := $(QUANTUM_PATH)/painter/tests/qp_draw_golden.cpp $(QP_COMMON_SRC) \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_dummy.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c
+qp_draw_golden_INC := $(QP_COMMON_INC) \
+	$(DRIVER_PATH)/painter/generic
@@ -0,0 +1,9 @@
+TEST_LIST += \
+	qp_draw_text \
+	qp_draw_text_glyph_cache \
+	qp_draw_image \
+	qp_draw_palette \
+	qp_draw_palette_cache \
+	qp_draw_golden \
+	qp_flash_assets \
+	qp_flash_assets_fonts_to_ram
@@ -0,0 +1,35 @@
+#if defined(RGB_MATRIX_PARTICLE_EFFECTS) && defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(ENABLE_RGB_MATRIX_PARTICLE_RIPPLE)
+RGB_MATRIX_EFFECT(PARTICLE_RIPPLE)
+#    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+
+#        ifndef RGB_MATRIX_PARTICLE_RIPPLE_POINTS
+#            define RGB_MATRIX_PARTICLE_RIPPLE_POINTS 8
+#        endif
+
+static const rgb_particle_physics_t particle_ripple_physics = {.gravity = 0, .trail = 48};
+
+// Sends a ring of particles outwards from the pressed key
+void process_rgb_matrix_particle_ripple(uint8_t row, uint8_t col) {
+    uint8_t led[LED_HITS_TO_REMEMBER];
+    uint8_t led_count = rgb_matrix_map_row_column_to_led(row, col, led);
+    int16_t speed     = (48 + rgb_matrix_config.speed / 2) * 16;
+
+    for (uint8_t i = 0; i < led_count; i++) {
+        for (uint8_t j = 0; j < RGB_MATRIX_PARTICLE_RIPPLE_POINTS; j++) {
+            uint8_t angle = j * (256 / RGB_MATRIX_PARTICLE_RIPPLE_POINTS);
+            int16_t vx    = ((int32_t)(cos8(angle) - 128) * speed) >> 7;
+            int16_t vy    = ((int32_t)(sin8(angle) - 128) * speed) >> 7;
+            rgb_particle_emit(g_led_config.point[led[i]].x, g_led_config.point[led[i]].y, vx, vy, 255, 8, rgb_matrix_config.hsv.h);
+        }
+    }
+}
+
+bool PARTICLE_RIPPLE(effect_params_t* params) {
+    if (params->init) {
+        rgb_particles_reset();
+    }
+    return effect_runner_particles(params, &particle_ripple_physics);
+}
+
+#    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#endif     // defined(RGB_MATRIX_PARTICLE_EFFECTS) && defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(ENABLE_RGB_MATRIX_PARTICLE_RIPPLE)
@@ -0,0 +1,29 @@
+#if defined(RGB_MATRIX_PARTICLE_EFFECTS) && defined(ENABLE_RGB_MATRIX_PARTICLE_SPARKS)
+RGB_MATRIX_EFFECT(PARTICLE_SPARKS)
+#    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+
+static const rgb_particle_physics_t particle_sparks_physics = {.gravity = 60 * 16, .trail = 24};
+
+bool PARTICLE_SPARKS(effect_params_t* params) {
+    static uint32_t emit_budget;
+
+    if (params->init) {
+        rgb_particles_reset();
+        emit_budget = 0;
+    }
+
+    if (params->iter == 0) {
+        // Spawn rate scales with speed and elapsed time, not with the frame rate
+        emit_budget += qadd8(rgb_matrix_config.speed, 16) * params->delta;
+        while (emit_budget >= 4096) {
+            uint8_t i = random8_max(RGB_MATRIX_LED_COUNT);
+            rgb_particle_emit(g_led_config.point[i].x, g_led_config.point[i].y, (random8() - 128) * 2, -(480 + random8() * 2), 255, 6, rgb_matrix_config.hsv.h + random8_max(32) - 16);
+            emit_budget -= 4096;
+        }
+    }
+
+    return effect_runner_particles(params, &particle_sparks_physics);
+}
+
+#    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#endif     // defined(RGB_MATRIX_PARTICLE_EFFECTS) && defined(ENABLE_RGB_MATRIX_PARTICLE_SPARKS)
@@ -0,0 +1,68 @@
+#pragma once
+
+#ifdef RGB_MATRIX_KEYFRAME_EFFECTS
+
+// Milliseconds between the keyframes that the effect function is evaluated at
+#    ifndef RGB_MATRIX_KEYFRAME_INTERVAL
+#        define RGB_MATRIX_KEYFRAME_INTERVAL 64
+#    endif
+
+static hsv_t    rgb_keyframes[2][RGB_MATRIX_LED_COUNT];
+static uint32_t rgb_keyframe_start;
+static uint8_t  rgb_keyframe_update; // keyframes to evaluate this frame, counted from the newest
+
+static inline uint8_t rgb_keyframe_time(uint32_t ms) {
+    return scale16by8(ms, qadd8(rgb_matrix_config.speed / 4, 1));
+}
+
+static inline uint8_t rgb_keyframe_lerp(uint8_t a, uint8_t b, uint8_t frac) {
+    return a + (((int16_t)(b - a) * frac) >> 8);
+}
+
+// Hue takes the shortest way round the colour wheel
+static inline uint8_t rgb_keyframe_lerp_hue(uint8_t a, uint8_t b, uint8_t frac) {
+    return a + (((int16_t)(int8_t)(b - a) * frac) >> 8);
+}
+
+// Like effect_runner_i(), but only evaluates effect_func every RGB_MATRIX_KEYFRAME_INTERVAL
+// and interpolates the frames in between, for effects too expensive to run every frame
+bool effect_runner_keyframes(effect_params_t* params, i_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    rgb_matrix_hsv_batch_t batch = {0};
+
+    if (params->iter == 0) {
+        uint32_t since = g_rgb_timer - rgb_keyframe_start;
+        if (params->init || since >= 2 * RGB_MATRIX_KEYFRAME_INTERVAL) {
+            rgb_keyframe_start  = g_rgb_timer;
+            rgb_keyframe_update = 2;
+        } else if (since >= RGB_MATRIX_KEYFRAME_INTERVAL) {
+            rgb_keyframe_start += RGB_MATRIX_KEYFRAME_INTERVAL;
+            rgb_keyframe_update = 1;
+        } else {
+            rgb_keyframe_update = 0;
+        }
+    }
+
+    uint8_t time[2] = {rgb_keyframe_time(rgb_keyframe_start), rgb_keyframe_time(rgb_keyframe_start + RGB_MATRIX_KEYFRAME_INTERVAL)};
+    uint8_t frac    = ((g_rgb_timer - rgb_keyframe_start) << 8) / RGB_MATRIX_KEYFRAME_INTERVAL;
+    for (uint8_t i = led_min; i < led_max; i++) {
+        if (rgb_keyframe_update == 2) {
+            rgb_keyframes[0][i] = effect_func(rgb_matrix_config.hsv, i, time[0]);
+        } else if (rgb_keyframe_update == 1) {
+            rgb_keyframes[0][i] = rgb_keyframes[1][i];
+        }
+        if (rgb_keyframe_update) {
+            rgb_keyframes[1][i] = effect_func(rgb_matrix_config.hsv, i, time[1]);
+        }
+
+        RGB_MATRIX_TEST_LED_FLAGS();
+        hsv_t from = rgb_keyframes[0][i];
+        hsv_t to   = rgb_keyframes[1][i];
+        hsv_t hsv  = {rgb_keyframe_lerp_hue(from.h, to.h, frac), rgb_keyframe_lerp(from.s, to.s, frac), rgb_keyframe_lerp(from.v, to.v, frac)};
+        rgb_matrix_hsv_batch_push(&batch, i, hsv);
+    }
+    rgb_matrix_hsv_batch_flush(&batch);
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+#endif // RGB_MATRIX_KEYFRAME_EFFECTS
@@ -0,0 +1,158 @@
+#pragma once
+
+#ifdef RGB_MATRIX_PARTICLE_EFFECTS
+
+// Particle positions are in LED coordinate space (0-224, 0-64) as 8.8 fixed point.
+// Velocities are in 1/16 LED units per second and accelerations in 1/16 LED units
+// per second squared, where a "second" is 1024 ms so that scaling is a shift.
+#    ifndef RGB_MATRIX_PARTICLE_COUNT
+#        define RGB_MATRIX_PARTICLE_COUNT 32
+#    endif
+
+// Particles are mapped onto their nearest LED through a grid of 2^shift sized cells
+#    ifndef RGB_MATRIX_PARTICLE_GRID_SHIFT
+#        define RGB_MATRIX_PARTICLE_GRID_SHIFT 4
+#    endif
+
+#    define RGB_MATRIX_PARTICLE_GRID_W ((224 >> RGB_MATRIX_PARTICLE_GRID_SHIFT) + 1)
+#    define RGB_MATRIX_PARTICLE_GRID_H ((64 >> RGB_MATRIX_PARTICLE_GRID_SHIFT) + 1)
+
+typedef struct {
+    uint16_t x[RGB_MATRIX_PARTICLE_COUNT];
+    uint16_t y[RGB_MATRIX_PARTICLE_COUNT];
+    int16_t  vx[RGB_MATRIX_PARTICLE_COUNT];
+    int16_t  vy[RGB_MATRIX_PARTICLE_COUNT];
+    uint8_t  life[RGB_MATRIX_PARTICLE_COUNT]; // 0 marks a free slot
+    uint8_t  fade[RGB_MATRIX_PARTICLE_COUNT]; // life lost every 16 ms
+    uint8_t  hue[RGB_MATRIX_PARTICLE_COUNT];
+} rgb_particle_pool_t;
+
+typedef struct {
+    int16_t gravity; // positive pulls towards the bottom of the board
+    uint8_t trail;   // field value lost every 16 ms
+} rgb_particle_physics_t;
+
+static rgb_particle_pool_t rgb_particles;
+static uint8_t             rgb_particle_cursor;
+static uint8_t             rgb_particle_field[RGB_MATRIX_LED_COUNT];
+static uint8_t             rgb_particle_field_hue[RGB_MATRIX_LED_COUNT];
+static uint8_t             rgb_particle_grid[RGB_MATRIX_PARTICLE_GRID_H][RGB_MATRIX_PARTICLE_GRID_W];
+static bool                rgb_particle_grid_valid = false;
+static uint8_t             rgb_particle_delta;
+
+static void rgb_particle_build_grid(void) {
+    for (uint8_t gy = 0; gy < RGB_MATRIX_PARTICLE_GRID_H; gy++) {
+        for (uint8_t gx = 0; gx < RGB_MATRIX_PARTICLE_GRID_W; gx++) {
+            int16_t  cx      = (gx << RGB_MATRIX_PARTICLE_GRID_SHIFT) + (1 << RGB_MATRIX_PARTICLE_GRID_SHIFT) / 2;
+            int16_t  cy      = (gy << RGB_MATRIX_PARTICLE_GRID_SHIFT) + (1 << RGB_MATRIX_PARTICLE_GRID_SHIFT) / 2;
+            uint16_t nearest = UINT16_MAX;
+            for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+                int16_t  dx   = g_led_config.point[i].x - cx;
+                int16_t  dy   = g_led_config.point[i].y - cy;
+                uint16_t dist = dx * dx + dy * dy;
+                if (dist < nearest) {
+                    nearest                   = dist;
+                    rgb_particle_grid[gy][gx] = i;
+                }
+            }
+        }
+    }
+    rgb_particle_grid_valid = true;
+}
+
+void rgb_particles_reset(void) {
+    if (!rgb_particle_grid_valid) {
+        rgb_particle_build_grid();
+    }
+    memset(&rgb_particles, 0, sizeof(rgb_particles));
+    memset(rgb_particle_field, 0, sizeof(rgb_particle_field));
+    rgb_particle_cursor = 0;
+    rgb_particle_delta  = 0;
+}
+
+// Takes the next free slot, or recycles the slot under the cursor if the pool is full
+void rgb_particle_emit(uint8_t x, uint8_t y, int16_t vx, int16_t vy, uint8_t life, uint8_t fade, uint8_t hue) {
+    uint8_t p = rgb_particle_cursor;
+    for (uint8_t n = 0; n < RGB_MATRIX_PARTICLE_COUNT; n++) {
+        uint8_t slot = (rgb_particle_cursor + n) % RGB_MATRIX_PARTICLE_COUNT;
+        if (!rgb_particles.life[slot]) {
+            p = slot;
+            break;
+        }
+    }
+    rgb_particle_cursor = (p + 1) % RGB_MATRIX_PARTICLE_COUNT;
+
+    rgb_particles.x[p]    = x << 8;
+    rgb_particles.y[p]    = y << 8;
+    rgb_particles.vx[p]   = vx;
+    rgb_particles.vy[p]   = vy;
+    rgb_particles.life[p] = life;
+    rgb_particles.fade[p] = fade;
+    rgb_particles.hue[p]  = hue;
+}
+
+static void rgb_particles_advect(uint8_t first, uint8_t last, const rgb_particle_physics_t* physics) {
+    uint8_t dt = rgb_particle_delta;
+    for (uint8_t p = first; p < last; p++) {
+        if (!rgb_particles.life[p]) continue;
+
+        uint16_t loss = (rgb_particles.fade[p] * dt) >> 4;
+        int32_t  x    = rgb_particles.x[p] + (((int32_t)rgb_particles.vx[p] * dt) >> 6);
+        int32_t  y    = rgb_particles.y[p] + (((int32_t)rgb_particles.vy[p] * dt) >> 6);
+        if (loss >= rgb_particles.life[p] || x < 0 || y < 0 || x > (224 << 8) || y > (64 << 8)) {
+            rgb_particles.life[p] = 0;
+            continue;
+        }
+        rgb_particles.life[p] -= loss;
+        rgb_particles.vy[p] += ((int32_t)physics->gravity * dt) >> 10;
+        rgb_particles.x[p] = x;
+        rgb_particles.y[p] = y;
+
+        uint8_t i = rgb_particle_grid[y >> (8 + RGB_MATRIX_PARTICLE_GRID_SHIFT)][x >> (8 + RGB_MATRIX_PARTICLE_GRID_SHIFT)];
+        if (rgb_particles.life[p] >= rgb_particle_field[i]) {
+            rgb_particle_field[i]     = rgb_particles.life[p];
+            rgb_particle_field_hue[i] = rgb_particles.hue[p];
+        }
+    }
+}
+
+// Each chunk of LEDs advects the matching share of the particle pool, so a frame
+// split by RGB_MATRIX_LED_PROCESS_LIMIT spreads the simulation out the same way.
+// On split keyboards each half only renders its own LEDs, so the whole pool is
+// shared out across those.
+bool effect_runner_particles(effect_params_t* params, const rgb_particle_physics_t* physics) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    rgb_matrix_hsv_batch_t batch = {0};
+
+    if (params->iter == 0) {
+        rgb_particle_delta = params->delta > UINT8_MAX ? UINT8_MAX : params->delta;
+    }
+
+    uint8_t range_min = 0;
+    uint8_t range_max = RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+    uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
+    if (is_keyboard_left()) {
+        range_max = k_rgb_matrix_split[0];
+    } else {
+        range_min = k_rgb_matrix_split[0];
+    }
+#    endif
+    if (range_max > range_min) {
+        uint8_t first = (uint16_t)(led_min - range_min) * RGB_MATRIX_PARTICLE_COUNT / (range_max - range_min);
+        uint8_t last  = (uint16_t)(led_max - range_min) * RGB_MATRIX_PARTICLE_COUNT / (range_max - range_min);
+        rgb_particles_advect(first, last, physics);
+    }
+
+    uint16_t trail = (physics->trail * rgb_particle_delta) >> 4;
+    for (uint8_t i = led_min; i < led_max; i++) {
+        rgb_particle_field[i] = trail >= rgb_particle_field[i] ? 0 : rgb_particle_field[i] - trail;
+        RGB_MATRIX_TEST_LED_FLAGS();
+        hsv_t hsv = {rgb_particle_field_hue[i], rgb_matrix_config.hsv.s, scale8(rgb_particle_field[i], rgb_matrix_config.hsv.v)};
+        rgb_matrix_hsv_batch_push(&batch, i, hsv);
+    }
+    rgb_matrix_hsv_batch_flush(&batch);
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+#endif // RGB_MATRIX_PARTICLE_EFFECTS
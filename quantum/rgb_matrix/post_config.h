@@ -11,6 +11,12 @@
 #    define RGB_MATRIX_FRAMEBUFFER_EFFECTS
 #endif
 
+// particles
+#if defined(ENABLE_RGB_MATRIX_PARTICLE_SPARKS) || \
+    defined(ENABLE_RGB_MATRIX_PARTICLE_RIPPLE)
+#    define RGB_MATRIX_PARTICLE_EFFECTS
+#endif
+
 // reactive
 #if defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE_SIMPLE) || \
     defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE) || \
@@ -24,6 +30,7 @@
     defined(ENABLE_RGB_MATRIX_MULTISPLASH) || \
     defined(ENABLE_RGB_MATRIX_SOLID_SPLASH) || \
     defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE_NEXUS) || \
-    defined(ENABLE_RGB_MATRIX_SOLID_MULTISPLASH)
+    defined(ENABLE_RGB_MATRIX_SOLID_MULTISPLASH) || \
+    defined(ENABLE_RGB_MATRIX_PARTICLE_RIPPLE)
 #    define RGB_MATRIX_KEYPRESSES
 #endif
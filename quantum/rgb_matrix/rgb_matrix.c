@@ -34,10 +34,53 @@ const led_point_t k_rgb_matrix_center = {112, 32};
 const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 
-__attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+static rgb_t rgb_matrix_hsv_to_rgb_default(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Aliased, rather than defined directly, so that the batch conversion can tell whether it has been overridden
+__attribute__((weak, alias("rgb_matrix_hsv_to_rgb_default"))) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv);
+
+// Only uses the batched conversion if rgb_matrix_hsv_to_rgb() hasn't been overridden, so any colour correction is kept
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    if (rgb_matrix_hsv_to_rgb == rgb_matrix_hsv_to_rgb_default) {
+        hsv_to_rgb_batch(hsv, rgb, count);
+        return;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+}
+
+/*
+ * Effects queue up the colours of the LEDs they render, which are then
+ * converted and applied a batch at a time.
+ */
+typedef struct {
+    uint8_t count;
+    uint8_t index[RGB_MATRIX_HSV_BATCH_SIZE];
+    hsv_t   hsv[RGB_MATRIX_HSV_BATCH_SIZE];
+} rgb_matrix_hsv_batch_t;
+
+static void rgb_matrix_hsv_batch_flush(rgb_matrix_hsv_batch_t *batch) {
+    rgb_t rgb[RGB_MATRIX_HSV_BATCH_SIZE];
+
+    rgb_matrix_hsv_to_rgb_batch(batch->hsv, rgb, batch->count);
+    for (uint8_t i = 0; i < batch->count; i++) {
+        rgb_matrix_set_color(batch->index[i], rgb[i].r, rgb[i].g, rgb[i].b);
+    }
+    batch->count = 0;
+}
+
+static inline void rgb_matrix_hsv_batch_push(rgb_matrix_hsv_batch_t *batch, uint8_t index, hsv_t hsv) {
+    batch->index[batch->count] = index;
+    batch->hsv[batch->count]   = hsv;
+    if (++batch->count == RGB_MATRIX_HSV_BATCH_SIZE) {
+        rgb_matrix_hsv_batch_flush(batch);
+    }
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -71,13 +114,38 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+rgb_led_geometry_t g_rgb_led_geometry[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_LED_GEOMETRY_CACHE
 
 // internals
 static bool            suspend_state     = false;
 static uint8_t         rgb_last_enable   = UINT8_MAX;
 static uint8_t         rgb_last_effect   = UINT8_MAX;
-static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
+static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false, 0};
 static rgb_task_states rgb_task_state    = SYNCING;
+static bool            driver_shutdown   = false;
+
+#ifdef RGB_MATRIX_POST_PROCESS
+// colours as set by the effects, before post processing
+static rgb_t rgb_frame[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_POST_PROCESS
+
+#ifdef RGB_MATRIX_COMPOSITING
+// rgb_frame is the base layer, the layers above it only cover the LEDs set during the current frame
+typedef struct {
+    rgb_t   color[RGB_MATRIX_LED_COUNT];
+    uint8_t touched[(RGB_MATRIX_LED_COUNT + 7) / 8];
+} rgb_overlay_t;
+
+static rgb_overlay_t   rgb_overlays[RGB_MATRIX_LAYER_COUNT - 1];
+static uint8_t         rgb_layer_blend[RGB_MATRIX_LAYER_COUNT] = {RGB_MATRIX_BLEND_NORMAL, RGB_MATRIX_BLEND_ADD, RGB_MATRIX_BLEND_NORMAL};
+static uint8_t         rgb_layer_alpha[RGB_MATRIX_LAYER_COUNT] = {UINT8_MAX, UINT8_MAX, UINT8_MAX};
+static uint8_t         rgb_target_layer                        = RGB_MATRIX_LAYER_BASE;
+static uint8_t         rgb_overlay_mode                        = RGB_MATRIX_DEFAULT_OVERLAY_MODE;
+static uint8_t         rgb_last_overlay_mode                   = UINT8_MAX;
+static effect_params_t rgb_overlay_params                      = {0, LED_FLAG_ALL, false, 0};
+#endif // RGB_MATRIX_COMPOSITING
 
 // double buffers
 static uint32_t rgb_timer_buffer;
@@ -90,6 +158,21 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
+// adaptive process limit
+#ifdef RGB_MATRIX_LED_PROCESS_ADAPTIVE
+static uint8_t                    adaptive_process_limit = RGB_MATRIX_LED_PROCESS_LIMIT;
+static uint8_t                    adaptive_limits_iter   = UINT8_MAX;
+static struct rgb_matrix_limits_t adaptive_limits;
+#endif // RGB_MATRIX_LED_PROCESS_ADAPTIVE
+
+// render statistics
+#ifdef RGB_MATRIX_RENDER_STATS
+static rgb_matrix_render_stats_t render_stats;
+static uint16_t                  render_stats_frames;
+static uint16_t                  render_stats_worst_loop;
+static uint32_t                  render_stats_timer;
+#endif // RGB_MATRIX_RENDER_STATS
+
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, rgb_matrix_config);
 
 void eeconfig_force_flush_rgb_matrix(void) {
@@ -141,10 +224,6 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
     return led_count;
 }
 
-void rgb_matrix_update_pwm_buffers(void) {
-    rgb_matrix_driver.flush();
-}
-
 __attribute__((weak)) int rgb_matrix_led_index(int index) {
 #if defined(RGB_MATRIX_SPLIT)
     if (!is_keyboard_left() && index >= k_rgb_matrix_split[0]) {
@@ -154,12 +233,143 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
     return index;
 }
 
+#ifdef RGB_MATRIX_POST_PROCESS
+// Like scale8(), but a scale of 255 leaves the value untouched
+static inline uint8_t rgb_matrix_post_scale(uint8_t value, uint8_t scale) {
+    return (value * (scale + 1)) >> 8;
+}
+
+#    ifdef RGB_MATRIX_COMPOSITING
+static inline uint8_t rgb_matrix_blend_channel(uint8_t below, uint8_t above, uint8_t blend, uint8_t alpha) {
+    uint8_t value;
+    switch (blend) {
+        case RGB_MATRIX_BLEND_ADD:
+            value = qadd8(below, above);
+            break;
+        case RGB_MATRIX_BLEND_MULTIPLY:
+            value = rgb_matrix_post_scale(below, above);
+            break;
+        case RGB_MATRIX_BLEND_LIGHTEN:
+            value = below > above ? below : above;
+            break;
+        default:
+            value = above;
+            break;
+    }
+    if (alpha == UINT8_MAX) return value;
+    return (below * (UINT8_MAX - alpha) + value * (alpha + 1)) >> 8;
+}
+
+static inline rgb_t rgb_matrix_blend(rgb_t below, rgb_t above, uint8_t layer) {
+    uint8_t blend = rgb_layer_blend[layer];
+    uint8_t alpha = rgb_layer_alpha[layer];
+    return (rgb_t){
+        .r = rgb_matrix_blend_channel(below.r, above.r, blend, alpha),
+        .g = rgb_matrix_blend_channel(below.g, above.g, blend, alpha),
+        .b = rgb_matrix_blend_channel(below.b, above.b, blend, alpha),
+    };
+}
+
+// The base layer is blended over black, then each layer above over the result
+static inline rgb_t rgb_matrix_composite_led(uint8_t index) {
+    rgb_t rgb = rgb_frame[index];
+    if (rgb_layer_alpha[RGB_MATRIX_LAYER_BASE] != UINT8_MAX) {
+        rgb = rgb_matrix_blend((rgb_t){0, 0, 0}, rgb, RGB_MATRIX_LAYER_BASE);
+    }
+    for (uint8_t layer = RGB_MATRIX_LAYER_BASE + 1; layer < RGB_MATRIX_LAYER_COUNT; layer++) {
+        const rgb_overlay_t *overlay = &rgb_overlays[layer - 1];
+        if (rgb_layer_alpha[layer] && (overlay->touched[index / 8] & (1 << (index % 8)))) {
+            rgb = rgb_matrix_blend(rgb, overlay->color[index], layer);
+        }
+    }
+    return rgb;
+}
+#    endif // RGB_MATRIX_COMPOSITING
+
+static inline rgb_t rgb_matrix_post_process_led(uint8_t index) {
+#    ifdef RGB_MATRIX_COMPOSITING
+    rgb_t rgb = rgb_matrix_composite_led(index);
+#    else
+    rgb_t rgb = rgb_frame[index];
+#    endif // RGB_MATRIX_COMPOSITING
+#    ifdef RGB_MATRIX_GAMMA_CORRECTION
+    rgb.r = pgm_read_byte(&g_rgb_matrix_gamma[0][rgb.r]);
+    rgb.g = pgm_read_byte(&g_rgb_matrix_gamma[1][rgb.g]);
+    rgb.b = pgm_read_byte(&g_rgb_matrix_gamma[2][rgb.b]);
+#    endif // RGB_MATRIX_GAMMA_CORRECTION
+#    ifdef RGB_MATRIX_LED_CALIBRATION
+    rgb.r = rgb_matrix_post_scale(rgb.r, pgm_read_byte(&g_rgb_matrix_calibration[index].r));
+    rgb.g = rgb_matrix_post_scale(rgb.g, pgm_read_byte(&g_rgb_matrix_calibration[index].g));
+    rgb.b = rgb_matrix_post_scale(rgb.b, pgm_read_byte(&g_rgb_matrix_calibration[index].b));
+#    endif // RGB_MATRIX_LED_CALIBRATION
+    return rgb;
+}
+
+// Compositing, gamma, calibration and current limiting are applied in one pass on the way to the driver
+static void rgb_matrix_post_process(void) {
+    uint8_t led_min = 0;
+    uint8_t led_max = RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+    if (is_keyboard_left()) {
+        led_max = k_rgb_matrix_split[0];
+    } else {
+        led_min = k_rgb_matrix_split[0];
+    }
+#    endif
+#    ifdef RGB_MATRIX_CURRENT_LIMIT
+    // The estimate needs the whole frame, so it is summed before anything is written, and only
+    // frames over the budget are scaled down to it on the way to the driver
+    uint32_t total = 0;
+    for (uint8_t i = led_min; i < led_max; i++) {
+        rgb_t rgb = rgb_matrix_post_process_led(i);
+        total += rgb.r + rgb.g + rgb.b;
+    }
+    uint8_t scale = UINT8_MAX;
+    if (total * RGB_MATRIX_LED_CURRENT > (uint32_t)RGB_MATRIX_CURRENT_LIMIT * UINT8_MAX) {
+        uint32_t budget = (uint32_t)RGB_MATRIX_CURRENT_LIMIT * UINT8_MAX * 256 / (total * RGB_MATRIX_LED_CURRENT);
+        scale           = budget > 0 ? budget - 1 : 0;
+    }
+#    endif // RGB_MATRIX_CURRENT_LIMIT
+
+    for (uint8_t i = led_min; i < led_max; i++) {
+        rgb_t rgb = rgb_matrix_post_process_led(i);
+#    ifdef RGB_MATRIX_CURRENT_LIMIT
+        rgb.r = rgb_matrix_post_scale(rgb.r, scale);
+        rgb.g = rgb_matrix_post_scale(rgb.g, scale);
+        rgb.b = rgb_matrix_post_scale(rgb.b, scale);
+#    endif // RGB_MATRIX_CURRENT_LIMIT
+        rgb_matrix_driver.set_color(rgb_matrix_led_index(i), rgb.r, rgb.g, rgb.b);
+    }
+}
+#endif // RGB_MATRIX_POST_PROCESS
+
+void rgb_matrix_update_pwm_buffers(void) {
+#ifdef RGB_MATRIX_POST_PROCESS
+    rgb_matrix_post_process();
+#endif // RGB_MATRIX_POST_PROCESS
+    rgb_matrix_driver.flush();
+}
+
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_POST_PROCESS
+    if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
+#    ifdef RGB_MATRIX_COMPOSITING
+        if (rgb_target_layer != RGB_MATRIX_LAYER_BASE) {
+            rgb_overlay_t *overlay = &rgb_overlays[rgb_target_layer - 1];
+            overlay->color[index]  = (rgb_t){red, green, blue};
+            overlay->touched[index / 8] |= 1 << (index % 8);
+            return;
+        }
+#    endif // RGB_MATRIX_COMPOSITING
+        rgb_frame[index] = (rgb_t){red, green, blue};
+    }
+#else
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
+#endif // RGB_MATRIX_POST_PROCESS
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_SPLIT) || defined(RGB_MATRIX_POST_PROCESS)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -167,6 +377,14 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 #endif
 }
 
+// Whether the mode is rendering, either as the base effect or as the overlay
+static inline bool rgb_matrix_mode_is_active(uint8_t mode) {
+#ifdef RGB_MATRIX_COMPOSITING
+    if (rgb_overlay_mode == mode) return true;
+#endif // RGB_MATRIX_COMPOSITING
+    return rgb_matrix_config.mode == mode;
+}
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
@@ -210,11 +428,24 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
     if (pressed)
 #    endif // defined(RGB_MATRIX_KEYRELEASES)
     {
-        if (rgb_matrix_config.mode == RGB_MATRIX_TYPING_HEATMAP) {
+        if (rgb_matrix_mode_is_active(RGB_MATRIX_TYPING_HEATMAP)) {
             process_rgb_matrix_typing_heatmap(row, col);
         }
     }
 #endif // defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)
+
+#if defined(RGB_MATRIX_PARTICLE_EFFECTS) && defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(ENABLE_RGB_MATRIX_PARTICLE_RIPPLE)
+#    if defined(RGB_MATRIX_KEYRELEASES)
+    if (!pressed)
+#    else
+    if (pressed)
+#    endif // defined(RGB_MATRIX_KEYRELEASES)
+    {
+        if (rgb_matrix_mode_is_active(RGB_MATRIX_PARTICLE_RIPPLE)) {
+            process_rgb_matrix_particle_ripple(row, col);
+        }
+    }
+#endif // defined(RGB_MATRIX_PARTICLE_EFFECTS) && defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(ENABLE_RGB_MATRIX_PARTICLE_RIPPLE)
 }
 
 void rgb_matrix_test(void) {
@@ -279,53 +510,120 @@ static void rgb_task_start(void) {
     // reset iter
     rgb_effect_params.iter = 0;
 
+    // the frame is rendered at a single point in time, however many task runs it takes
+    uint32_t delta          = rgb_timer_buffer - g_rgb_timer;
+    rgb_effect_params.delta = delta > UINT16_MAX ? UINT16_MAX : delta;
+
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker = last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_COMPOSITING
+    // the layers above the base are drawn afresh every frame
+    for (uint8_t i = 0; i < RGB_MATRIX_LAYER_COUNT - 1; i++) {
+        memset(rgb_overlays[i].touched, 0, sizeof(rgb_overlays[i].touched));
+    }
+#endif // RGB_MATRIX_COMPOSITING
 
     // next task
     rgb_task_state = RENDERING;
 }
 
-static void rgb_task_render(uint8_t effect) {
-    bool rendering         = false;
-    rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
-    if (rgb_effect_params.flags != rgb_matrix_config.flags) {
-        rgb_effect_params.flags = rgb_matrix_config.flags;
-        rgb_matrix_set_color_all(0, 0, 0);
+#ifdef RGB_MATRIX_LED_PROCESS_ADAPTIVE
+static void rgb_adaptive_prepare_limits(uint8_t iter) {
+    // Chunk sizes change from frame to frame, so each chunk starts where the previous one ended
+    uint8_t min = (iter == 0) ? 0 : adaptive_limits.led_max_index;
+    uint8_t max = (RGB_MATRIX_LED_COUNT - min > adaptive_process_limit) ? min + adaptive_process_limit : RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+    if (is_keyboard_left() && (max > k_rgb_matrix_split[0])) max = k_rgb_matrix_split[0];
+    if (!(is_keyboard_left()) && (min < k_rgb_matrix_split[0])) {
+        min = k_rgb_matrix_split[0];
+        max = (RGB_MATRIX_LED_COUNT - min > adaptive_process_limit) ? min + adaptive_process_limit : RGB_MATRIX_LED_COUNT;
+    }
+#    endif
+    adaptive_limits.led_min_index = min;
+    adaptive_limits.led_max_index = max;
+    adaptive_limits_iter          = iter;
+}
+
+static void rgb_adaptive_update(uint32_t elapsed) {
+    // The timer only has millisecond resolution, so the chance of a render step
+    // straddling a tick is proportional to its duration. Back off quickly whenever
+    // the budget is hit, and creep back up while it isn't.
+    if (elapsed >= RGB_MATRIX_LED_PROCESS_BUDGET_MS) {
+        adaptive_process_limit -= adaptive_process_limit / 4;
+        if (adaptive_process_limit < RGB_MATRIX_LED_PROCESS_MIN) adaptive_process_limit = RGB_MATRIX_LED_PROCESS_MIN;
+    } else if (adaptive_process_limit < RGB_MATRIX_LED_COUNT) {
+        adaptive_process_limit++;
     }
+}
+#endif // RGB_MATRIX_LED_PROCESS_ADAPTIVE
+
+#ifdef RGB_MATRIX_RENDER_STATS
+static void rgb_render_stats_step(uint32_t elapsed) {
+    if (elapsed > render_stats_worst_loop) render_stats_worst_loop = elapsed;
+}
+
+static void rgb_render_stats_frame_done(uint8_t effect) {
+    // figures are only ever reported for a single effect, so start over when it changes
+    if (effect != render_stats.mode) {
+        render_stats            = (rgb_matrix_render_stats_t){.mode = effect};
+        render_stats_frames     = 0;
+        render_stats_worst_loop = 0;
+        render_stats_timer      = timer_read32();
+    }
+
+    render_stats_frames++;
+    if (timer_elapsed32(render_stats_timer) >= 1000) {
+        render_stats.fps           = render_stats_frames;
+        render_stats.worst_loop_ms = render_stats_worst_loop;
+#    ifdef RGB_MATRIX_LED_PROCESS_ADAPTIVE
+        render_stats.led_process_limit = adaptive_process_limit;
+#    else
+        render_stats.led_process_limit = RGB_MATRIX_LED_PROCESS_LIMIT;
+#    endif // RGB_MATRIX_LED_PROCESS_ADAPTIVE
+        render_stats_frames     = 0;
+        render_stats_worst_loop = 0;
+        render_stats_timer      = timer_read32();
+    }
+}
+
+rgb_matrix_render_stats_t rgb_matrix_get_render_stats(void) {
+    return render_stats;
+}
+#endif // RGB_MATRIX_RENDER_STATS
+
+static bool rgb_effect_render(uint8_t effect, effect_params_t *params) {
+    bool rendering = false;
 
-    // each effect can opt to do calculations
-    // and/or request PWM buffer updates.
     switch (effect) {
         case RGB_MATRIX_NONE:
-            rendering = rgb_matrix_none(&rgb_effect_params);
+            rendering = rgb_matrix_none(params);
             break;
 
 // ---------------------------------------------
 // -----Begin rgb effect switch case macros-----
-#define RGB_MATRIX_EFFECT(name, ...)          \
-    case RGB_MATRIX_##name:                   \
-        rendering = name(&rgb_effect_params); \
+#define RGB_MATRIX_EFFECT(name, ...) \
+    case RGB_MATRIX_##name:          \
+        rendering = name(params);    \
         break;
 #include "rgb_matrix_effects.inc"
 #undef RGB_MATRIX_EFFECT
 
 #ifdef COMMUNITY_MODULES_ENABLE
-#    define RGB_MATRIX_EFFECT(name, ...)          \
-        case RGB_MATRIX_COMMUNITY_MODULE_##name:  \
-            rendering = name(&rgb_effect_params); \
+#    define RGB_MATRIX_EFFECT(name, ...)         \
+        case RGB_MATRIX_COMMUNITY_MODULE_##name: \
+            rendering = name(params);            \
             break;
 #    include "rgb_matrix_community_modules.inc"
 #    undef RGB_MATRIX_EFFECT
 #endif
 
 #if defined(RGB_MATRIX_CUSTOM_KB) || defined(RGB_MATRIX_CUSTOM_USER)
-#    define RGB_MATRIX_EFFECT(name, ...)          \
-        case RGB_MATRIX_CUSTOM_##name:            \
-            rendering = name(&rgb_effect_params); \
+#    define RGB_MATRIX_EFFECT(name, ...) \
+        case RGB_MATRIX_CUSTOM_##name:   \
+            rendering = name(params);    \
             break;
 #    ifdef RGB_MATRIX_CUSTOM_KB
 #        include "rgb_matrix_kb.inc"
@@ -337,14 +635,52 @@ static void rgb_task_render(uint8_t effect) {
 #endif
             // -----End rgb effect switch case macros-------
             // ---------------------------------------------
+    }
 
-        // Factory default magic value
-        case UINT8_MAX: {
-            rgb_matrix_test();
-            rgb_task_state = FLUSHING;
-        }
-            return;
+    return rendering;
+}
+
+#ifdef RGB_MATRIX_COMPOSITING
+static bool rgb_overlay_active(uint8_t effect) {
+    return rgb_overlay_mode != RGB_MATRIX_NONE && effect != RGB_MATRIX_NONE && rgb_overlay_mode != effect;
+}
+#endif // RGB_MATRIX_COMPOSITING
+
+static void rgb_task_render(uint8_t effect) {
+    rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
+    if (rgb_effect_params.init) rgb_effect_params.delta = 0;
+    if (rgb_effect_params.flags != rgb_matrix_config.flags) {
+        rgb_effect_params.flags = rgb_matrix_config.flags;
+        rgb_matrix_set_color_all(0, 0, 0);
     }
+#ifdef RGB_MATRIX_LED_PROCESS_ADAPTIVE
+    rgb_adaptive_prepare_limits(rgb_effect_params.iter);
+#endif // RGB_MATRIX_LED_PROCESS_ADAPTIVE
+
+    // Factory default magic value
+    if (effect == UINT8_MAX) {
+        rgb_matrix_test();
+        rgb_task_state = FLUSHING;
+        return;
+    }
+
+    // each effect can opt to do calculations
+    // and/or request PWM buffer updates.
+    bool rendering = rgb_effect_render(effect, &rgb_effect_params);
+
+#ifdef RGB_MATRIX_COMPOSITING
+    // the overlay renders the same chunk of LEDs into its own layer, but never while the LEDs are going dark,
+    // nor when it is the base effect, as an effect's state would then be advanced twice per frame
+    if (rgb_overlay_active(effect)) {
+        rgb_overlay_params.init  = (rgb_overlay_mode != rgb_last_overlay_mode);
+        rgb_overlay_params.iter  = rgb_effect_params.iter;
+        rgb_overlay_params.flags = rgb_effect_params.flags;
+        rgb_overlay_params.delta = rgb_overlay_params.init ? 0 : rgb_effect_params.delta;
+        rgb_target_layer         = RGB_MATRIX_LAYER_REACTIVE;
+        rendering |= rgb_effect_render(rgb_overlay_mode, &rgb_overlay_params);
+        rgb_target_layer = RGB_MATRIX_LAYER_BASE;
+    }
+#endif // RGB_MATRIX_COMPOSITING
 
     rgb_effect_params.iter++;
 
@@ -362,19 +698,29 @@ static void rgb_task_flush(uint8_t effect) {
     // update last trackers after the first full render so we can init over several frames
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
+#ifdef RGB_MATRIX_COMPOSITING
+    // an overlay that was skipped starts over once it renders again
+    rgb_last_overlay_mode = rgb_overlay_active(effect) ? rgb_overlay_mode : RGB_MATRIX_NONE;
+#endif // RGB_MATRIX_COMPOSITING
 
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
+#ifdef RGB_MATRIX_RENDER_STATS
+    rgb_render_stats_frame_done(effect);
+#endif // RGB_MATRIX_RENDER_STATS
+
+    // the LEDs are now dark, so there is nothing left to do until they light up again
+    if (effect == RGB_MATRIX_NONE && !driver_shutdown) {
+        if (rgb_matrix_driver.shutdown) rgb_matrix_driver.shutdown();
+        driver_shutdown = true;
+    }
+
     // next task
     rgb_task_state = SYNCING;
 }
 
 void rgb_matrix_task(void) {
-    rgb_task_timers();
-
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
 #if RGB_MATRIX_TIMEOUT > 0
                              (last_input_activity_elapsed() > (uint32_t)RGB_MATRIX_TIMEOUT) ||
@@ -383,19 +729,47 @@ void rgb_matrix_task(void) {
 
     uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
 
+    // Once a dark frame has been flushed the driver is shut down and the task
+    // sleeps, only keeping an eye on EEPROM writes, until lighting comes back
+    if (driver_shutdown) {
+        if (!effect) {
+            eeconfig_flush_rgb_matrix(false);
+            return;
+        }
+        if (rgb_matrix_driver.wakeup) rgb_matrix_driver.wakeup();
+        driver_shutdown = false;
+    }
+
+    rgb_task_timers();
+
     switch (rgb_task_state) {
         case STARTING:
             rgb_task_start();
             break;
-        case RENDERING:
+        case RENDERING: {
+#ifdef RGB_MATRIX_RENDER_STATS
+            uint32_t render_start = timer_read32();
+#endif // RGB_MATRIX_RENDER_STATS
             rgb_task_render(effect);
             if (effect) {
+#ifdef RGB_MATRIX_COMPOSITING
+                rgb_target_layer = RGB_MATRIX_LAYER_INDICATORS;
+#endif // RGB_MATRIX_COMPOSITING
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
                     rgb_matrix_indicators();
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
+#ifdef RGB_MATRIX_COMPOSITING
+                rgb_target_layer = RGB_MATRIX_LAYER_BASE;
+#endif // RGB_MATRIX_COMPOSITING
             }
-            break;
+#ifdef RGB_MATRIX_LED_PROCESS_ADAPTIVE
+            rgb_adaptive_update(timer_elapsed32(render_start));
+#endif // RGB_MATRIX_LED_PROCESS_ADAPTIVE
+#ifdef RGB_MATRIX_RENDER_STATS
+            rgb_render_stats_step(timer_elapsed32(render_start));
+#endif // RGB_MATRIX_RENDER_STATS
+        } break;
         case FLUSHING:
             rgb_task_flush(effect);
             break;
@@ -424,6 +798,11 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
     struct rgb_matrix_limits_t limits = {0};
+#if defined(RGB_MATRIX_LED_PROCESS_ADAPTIVE)
+    if (iter == adaptive_limits_iter) {
+        return adaptive_limits;
+    }
+#endif // RGB_MATRIX_LED_PROCESS_ADAPTIVE
 #if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
 #    if defined(RGB_MATRIX_SPLIT)
     limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
@@ -473,9 +852,26 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+void rgb_matrix_update_geometry(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx                  = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy                  = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        g_rgb_led_geometry[i].dx    = dx;
+        g_rgb_led_geometry[i].dy    = dy;
+        g_rgb_led_geometry[i].dist  = sqrt16(dx * dx + dy * dy);
+        g_rgb_led_geometry[i].angle = atan2_8(dy, dx);
+    }
+}
+#endif // RGB_MATRIX_LED_GEOMETRY_CACHE
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+    rgb_matrix_update_geometry();
+#endif // RGB_MATRIX_LED_GEOMETRY_CACHE
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -573,6 +969,24 @@ uint8_t rgb_matrix_get_mode(void) {
     return rgb_matrix_config.mode;
 }
 
+#ifdef RGB_MATRIX_COMPOSITING
+void rgb_matrix_overlay_mode_noeeprom(uint8_t mode) {
+    rgb_overlay_mode = (mode < RGB_MATRIX_EFFECT_MAX) ? mode : RGB_MATRIX_NONE;
+    rgb_task_state   = STARTING;
+    dprintf("rgb matrix overlay mode: %u\n", rgb_overlay_mode);
+}
+
+uint8_t rgb_matrix_get_overlay_mode(void) {
+    return rgb_overlay_mode;
+}
+
+void rgb_matrix_set_layer_blend(rgb_matrix_layer_t layer, rgb_matrix_blend_t blend, uint8_t alpha) {
+    if (layer >= RGB_MATRIX_LAYER_COUNT) return;
+    rgb_layer_blend[layer] = blend;
+    rgb_layer_alpha[layer] = alpha;
+}
+#endif // RGB_MATRIX_COMPOSITING
+
 void rgb_matrix_step_helper(bool write_to_eeprom) {
     uint8_t mode = rgb_matrix_config.mode + 1;
     rgb_matrix_mode_eeprom_helper((mode < RGB_MATRIX_EFFECT_MAX) ? mode : 1, write_to_eeprom);
@@ -24,6 +24,7 @@
 #include "rgb_matrix_drivers.h"
 #include "color.h"
 #include "keyboard.h"
+#include "progmem.h"
 
 #ifndef RGB_MATRIX_TIMEOUT
 #    define RGB_MATRIX_TIMEOUT 0
@@ -90,6 +91,35 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#ifdef RGB_MATRIX_LED_PROCESS_ADAPTIVE
+#    ifndef RGB_MATRIX_LED_PROCESS_BUDGET_MS
+#        define RGB_MATRIX_LED_PROCESS_BUDGET_MS 1
+#    endif
+#    ifndef RGB_MATRIX_LED_PROCESS_MIN
+#        define RGB_MATRIX_LED_PROCESS_MIN 4
+#    endif
+#endif
+
+#ifndef RGB_MATRIX_HSV_BATCH_SIZE
+#    define RGB_MATRIX_HSV_BATCH_SIZE 16
+#endif
+
+#ifdef RGB_MATRIX_CURRENT_LIMIT
+#    ifndef RGB_MATRIX_LED_CURRENT
+#        define RGB_MATRIX_LED_CURRENT 20
+#    endif
+#endif
+
+#ifdef RGB_MATRIX_COMPOSITING
+#    ifndef RGB_MATRIX_DEFAULT_OVERLAY_MODE
+#        define RGB_MATRIX_DEFAULT_OVERLAY_MODE RGB_MATRIX_NONE
+#    endif
+#endif
+
+#if defined(RGB_MATRIX_GAMMA_CORRECTION) || defined(RGB_MATRIX_LED_CALIBRATION) || defined(RGB_MATRIX_CURRENT_LIMIT) || defined(RGB_MATRIX_COMPOSITING)
+#    define RGB_MATRIX_POST_PROCESS
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -97,6 +127,37 @@ struct rgb_matrix_limits_t {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter);
 
+#ifdef RGB_MATRIX_COMPOSITING
+typedef enum rgb_matrix_layer_t {
+    RGB_MATRIX_LAYER_BASE,       // the current mode
+    RGB_MATRIX_LAYER_REACTIVE,   // the overlay mode
+    RGB_MATRIX_LAYER_INDICATORS, // everything set from the indicator callbacks
+    RGB_MATRIX_LAYER_COUNT,
+} rgb_matrix_layer_t;
+
+typedef enum rgb_matrix_blend_t {
+    RGB_MATRIX_BLEND_NORMAL,   // mixes over the layers below by alpha
+    RGB_MATRIX_BLEND_ADD,      // adds to the layers below, saturating
+    RGB_MATRIX_BLEND_MULTIPLY, // darkens the layers below
+    RGB_MATRIX_BLEND_LIGHTEN,  // keeps the brighter of each channel
+} rgb_matrix_blend_t;
+#endif // RGB_MATRIX_COMPOSITING
+
+#if defined(RGB_MATRIX_LED_PROCESS_ADAPTIVE) && !defined(RGB_MATRIX_RENDER_STATS)
+#    define RGB_MATRIX_RENDER_STATS
+#endif
+
+#ifdef RGB_MATRIX_RENDER_STATS
+typedef struct rgb_matrix_render_stats_t {
+    uint16_t fps;               // frames flushed during the last second
+    uint16_t worst_loop_ms;     // longest single render step during the last second
+    uint8_t  led_process_limit; // current chunk size
+    uint8_t  mode;              // the effect these figures were measured on
+} rgb_matrix_render_stats_t;
+
+rgb_matrix_render_stats_t rgb_matrix_get_render_stats(void);
+#endif
+
 #define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter)                   \
     struct rgb_matrix_limits_t limits = rgb_matrix_get_limits(iter); \
     uint8_t                    min    = limits.led_min_index;        \
@@ -219,6 +280,14 @@ led_flags_t rgb_matrix_get_flags(void);
 void        rgb_matrix_set_flags(led_flags_t flags);
 void        rgb_matrix_set_flags_noeeprom(led_flags_t flags);
 void        rgb_matrix_update_pwm_buffers(void);
+#ifdef RGB_MATRIX_COMPOSITING
+void    rgb_matrix_overlay_mode_noeeprom(uint8_t mode);
+uint8_t rgb_matrix_get_overlay_mode(void);
+void    rgb_matrix_set_layer_blend(rgb_matrix_layer_t layer, rgb_matrix_blend_t blend, uint8_t alpha);
+#endif
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+void rgb_matrix_update_geometry(void);
+#endif
 
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_force_flush_rgb_matrix
@@ -286,3 +355,12 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_GAMMA_CORRECTION
+extern const uint8_t g_rgb_matrix_gamma[3][256] PROGMEM;
+#endif
+#ifdef RGB_MATRIX_LED_CALIBRATION
+extern const rgb_t g_rgb_matrix_calibration[RGB_MATRIX_LED_COUNT] PROGMEM;
+#endif
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+extern rgb_led_geometry_t g_rgb_led_geometry[RGB_MATRIX_LED_COUNT];
+#endif
@@ -20,20 +20,81 @@
 #include "keyboard.h"
 #include "color.h"
 #include "util.h"
+#include "gpio.h"
 
 /* Each driver needs to define the struct
  *    const rgb_matrix_driver_t rgb_matrix_driver;
- * All members must be provided.
+ * All members except shutdown and wakeup must be provided.
  * Keyboard custom drivers can define this in their own files, it should only
  * be here if shared between boards.
  */
 
+#if defined(RGB_MATRIX_IS31FL3218) && defined(IS31FL3218_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3218_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3236) && defined(IS31FL3236_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3236_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3729) && defined(IS31FL3729_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3729_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3731) && defined(IS31FL3731_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3731_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3733) && defined(IS31FL3733_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3733_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3736) && defined(IS31FL3736_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3736_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3737) && defined(IS31FL3737_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3737_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3741) && defined(IS31FL3741_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3741_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3742A) && defined(IS31FL3742A_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3742A_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3743A) && defined(IS31FL3743A_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3743A_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3745) && defined(IS31FL3745_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3745_SDB_PIN
+#elif defined(RGB_MATRIX_IS31FL3746A) && defined(IS31FL3746A_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN IS31FL3746A_SDB_PIN
+#elif defined(RGB_MATRIX_SNLED27351) && defined(SNLED27351_SDB_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN SNLED27351_SDB_PIN
+#elif defined(RGB_MATRIX_WS2812) && defined(WS2812_POWER_PIN)
+#    define RGB_MATRIX_SHUTDOWN_PIN WS2812_POWER_PIN
+#    ifdef WS2812_POWER_PIN_ON_STATE
+#        define RGB_MATRIX_SHUTDOWN_PIN_ON_STATE WS2812_POWER_PIN_ON_STATE
+#    endif
+#endif
+
+#ifndef RGB_MATRIX_SHUTDOWN_PIN_ON_STATE
+#    define RGB_MATRIX_SHUTDOWN_PIN_ON_STATE 1
+#endif
+
+#if defined(RGB_MATRIX_SHUTDOWN_PIN)
+/* Hardware shutdown: the IS31/SNLED SDB pin, or a switch on the WS2812 supply.
+ * IS31/SNLED registers are retained while shut down, and a WS2812 strip is
+ * rewritten in full by the first flush after waking, so nothing needs restoring.
+ */
+static void rgb_matrix_shutdown_pin_write(bool on) {
+    gpio_write_pin(RGB_MATRIX_SHUTDOWN_PIN, on == RGB_MATRIX_SHUTDOWN_PIN_ON_STATE);
+}
+
+static void rgb_matrix_driver_shutdown(void) {
+    rgb_matrix_shutdown_pin_write(false);
+}
+
+static void rgb_matrix_driver_wakeup(void) {
+    rgb_matrix_shutdown_pin_write(true);
+}
+
+#    define RGB_MATRIX_SHUTDOWN_HOOKS .shutdown = rgb_matrix_driver_shutdown, .wakeup = rgb_matrix_driver_wakeup,
+#else
+#    define RGB_MATRIX_SHUTDOWN_HOOKS
+#endif
+
 #if defined(RGB_MATRIX_IS31FL3218)
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3218_init,
     .flush         = is31fl3218_update_pwm_buffers,
     .set_color     = is31fl3218_set_color,
     .set_color_all = is31fl3218_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3236)
@@ -42,6 +103,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3236_flush,
     .set_color     = is31fl3236_set_color,
     .set_color_all = is31fl3236_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3729)
@@ -50,6 +112,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3729_flush,
     .set_color     = is31fl3729_set_color,
     .set_color_all = is31fl3729_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3731)
@@ -58,6 +121,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3731_flush,
     .set_color     = is31fl3731_set_color,
     .set_color_all = is31fl3731_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3733)
@@ -66,6 +130,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3733_flush,
     .set_color     = is31fl3733_set_color,
     .set_color_all = is31fl3733_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3736)
@@ -74,6 +139,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3736_flush,
     .set_color     = is31fl3736_set_color,
     .set_color_all = is31fl3736_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3737)
@@ -82,6 +148,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3737_flush,
     .set_color     = is31fl3737_set_color,
     .set_color_all = is31fl3737_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3741)
@@ -90,6 +157,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3741_flush,
     .set_color     = is31fl3741_set_color,
     .set_color_all = is31fl3741_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3742A)
@@ -98,6 +166,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3742a_flush,
     .set_color     = is31fl3742a_set_color,
     .set_color_all = is31fl3742a_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3743A)
@@ -106,6 +175,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3743a_flush,
     .set_color     = is31fl3743a_set_color,
     .set_color_all = is31fl3743a_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3745)
@@ -114,6 +184,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3745_flush,
     .set_color     = is31fl3745_set_color,
     .set_color_all = is31fl3745_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_IS31FL3746A)
@@ -122,6 +193,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = is31fl3746a_flush,
     .set_color     = is31fl3746a_set_color,
     .set_color_all = is31fl3746a_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_SNLED27351)
@@ -130,6 +202,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = snled27351_flush,
     .set_color     = snled27351_set_color,
     .set_color_all = snled27351_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #elif defined(RGB_MATRIX_AW20216S)
@@ -146,11 +219,24 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 #        pragma message "You need to use a custom driver, or re-implement the WS2812 driver to use a different configuration."
 #    endif
 
+#    if defined(WS2812_POWER_PIN)
+static void ws2812_power_init(void) {
+    gpio_set_pin_output(WS2812_POWER_PIN);
+    rgb_matrix_driver_wakeup();
+    ws2812_init();
+}
+#    endif
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
+#    if defined(WS2812_POWER_PIN)
+    .init          = ws2812_power_init,
+#    else
     .init          = ws2812_init,
+#    endif
     .flush         = ws2812_flush,
     .set_color     = ws2812_set_color,
     .set_color_all = ws2812_set_color_all,
+    RGB_MATRIX_SHUTDOWN_HOOKS
 };
 
 #endif
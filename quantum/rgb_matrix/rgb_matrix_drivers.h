@@ -46,6 +46,10 @@ typedef struct {
     void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Optional: power the LEDs down once they have been flushed dark. */
+    void (*shutdown)(void);
+    /* Optional: power the LEDs back up before the next frame is rendered. */
+    void (*wakeup)(void);
 } rgb_matrix_driver_t;
 
 extern const rgb_matrix_driver_t rgb_matrix_driver;
@@ -50,6 +50,7 @@ typedef struct PACKED {
     uint8_t     iter;
     led_flags_t flags;
     bool        init;
+    uint16_t    delta; // milliseconds since the previous frame, 0 when init is set
 } effect_params_t;
 
 typedef struct PACKED {
@@ -57,6 +58,16 @@ typedef struct PACKED {
     uint8_t y;
 } led_point_t;
 
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+// Position of an LED relative to the matrix center
+typedef struct PACKED {
+    int16_t dx;
+    int16_t dy;
+    uint8_t dist;
+    uint8_t angle;
+} rgb_led_geometry_t;
+#endif // RGB_MATRIX_LED_GEOMETRY_CACHE
+
 #define HAS_FLAGS(bits, flags) ((bits & flags) == flags)
 #define HAS_ANY_FLAGS(bits, flags) ((bits & flags) != 0x00)
 
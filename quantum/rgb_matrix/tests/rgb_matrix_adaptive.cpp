@@ -0,0 +1,60 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix_test_host.hpp"
+
+extern "C" {
+extern uint8_t  adaptive_probe_chunks[256];
+extern uint8_t  adaptive_probe_chunk_count;
+extern uint32_t adaptive_probe_step_ms;
+}
+
+#include <vector>
+
+class RgbMatrixAdaptive : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+            g_led_config.flags[led] = LED_FLAG_KEYLIGHT;
+        }
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_CUSTOM_ADAPTIVE_PROBE);
+    }
+
+    // Runs the task until a frame has been flushed, returning the number of LEDs given to each render step
+    static std::vector<uint8_t> render_frame(uint32_t step_ms) {
+        adaptive_probe_step_ms     = step_ms;
+        adaptive_probe_chunk_count = 0;
+        ::render_frame();
+        return std::vector<uint8_t>(adaptive_probe_chunks, adaptive_probe_chunks + adaptive_probe_chunk_count);
+    }
+};
+
+TEST_F(RgbMatrixAdaptive, BacksOffWhenStepsAreSlow) {
+    // The first frame starts at RGB_MATRIX_LED_PROCESS_LIMIT, and each step over budget drops a quarter
+    EXPECT_EQ(render_frame(RGB_MATRIX_LED_PROCESS_BUDGET_MS), (std::vector<uint8_t>{32, 24, 8}));
+    EXPECT_EQ(render_frame(RGB_MATRIX_LED_PROCESS_BUDGET_MS), (std::vector<uint8_t>{14, 11, 9, 7, 6, 5, 4, 4, 4}));
+
+    // Never dropping below RGB_MATRIX_LED_PROCESS_MIN
+    uint32_t start = timer_read32();
+    while (timer_elapsed32(start) < 1100) {
+        for (uint8_t chunk : render_frame(RGB_MATRIX_LED_PROCESS_BUDGET_MS)) {
+            EXPECT_EQ(chunk, RGB_MATRIX_LED_PROCESS_MIN);
+        }
+    }
+    EXPECT_EQ(rgb_matrix_get_render_stats().led_process_limit, RGB_MATRIX_LED_PROCESS_MIN);
+}
+
+TEST_F(RgbMatrixAdaptive, GrowsWhenStepsAreFast) {
+    render_frame(RGB_MATRIX_LED_PROCESS_BUDGET_MS);
+    EXPECT_EQ(render_frame(0), (std::vector<uint8_t>{4, 5, 6, 7, 8, 9, 10, 11, 4}));
+
+    // Until the whole matrix is rendered in a single step
+    uint32_t start = timer_read32();
+    while (timer_elapsed32(start) < 1100) {
+        render_frame(0);
+    }
+    EXPECT_EQ(render_frame(0), (std::vector<uint8_t>{RGB_MATRIX_LED_COUNT}));
+    EXPECT_EQ(rgb_matrix_get_render_stats().led_process_limit, RGB_MATRIX_LED_COUNT);
+}
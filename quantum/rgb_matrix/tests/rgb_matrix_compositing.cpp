@@ -0,0 +1,109 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix_test_host.hpp"
+
+static int   indicator_led = -1;
+static rgb_t indicator_color;
+
+extern "C" {
+bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    if (indicator_led >= led_min && indicator_led < led_max) {
+        rgb_matrix_set_color(indicator_led, indicator_color.r, indicator_color.g, indicator_color.b);
+    }
+    return false;
+}
+}
+
+class RgbMatrixCompositing : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+            g_led_config.matrix_co[0][led] = led;
+            g_led_config.point[led].x      = 224 * led / (RGB_MATRIX_LED_COUNT - 1);
+            g_led_config.point[led].y      = 32;
+            g_led_config.flags[led]        = LED_FLAG_KEYLIGHT;
+        }
+        set_time(0);
+        rgb_matrix_init();
+    }
+
+    void SetUp() override {
+        indicator_led = -1;
+        rgb_matrix_set_layer_blend(RGB_MATRIX_LAYER_BASE, RGB_MATRIX_BLEND_NORMAL, 255);
+        rgb_matrix_set_layer_blend(RGB_MATRIX_LAYER_REACTIVE, RGB_MATRIX_BLEND_ADD, 255);
+        rgb_matrix_set_layer_blend(RGB_MATRIX_LAYER_INDICATORS, RGB_MATRIX_BLEND_NORMAL, 255);
+        rgb_matrix_overlay_mode_noeeprom(RGB_MATRIX_NONE);
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        render_frame();
+    }
+};
+
+TEST_F(RgbMatrixCompositing, IndicatorsCoverTheBaseByDefault) {
+    indicator_led   = 1;
+    indicator_color = {0, 0, 200};
+    render_frame();
+
+    EXPECT_EQ(output[0].r, 255);
+    EXPECT_EQ(output[1].r, 0);
+    EXPECT_EQ(output[1].b, 200);
+}
+
+TEST_F(RgbMatrixCompositing, IndicatorsBlendByAlpha) {
+    rgb_matrix_set_layer_blend(RGB_MATRIX_LAYER_INDICATORS, RGB_MATRIX_BLEND_NORMAL, 127);
+    indicator_led   = 2;
+    indicator_color = {0, 0, 200};
+    render_frame();
+
+    EXPECT_EQ(output[2].r, 127);
+    EXPECT_EQ(output[2].b, 100);
+}
+
+TEST_F(RgbMatrixCompositing, LayersOnlyCoverTheLedsSetThisFrame) {
+    indicator_led   = 3;
+    indicator_color = {0, 200, 0};
+    render_frame();
+    EXPECT_EQ(output[3].g, 200);
+
+    indicator_led = -1;
+    render_frame();
+    EXPECT_EQ(output[3].r, 255);
+    EXPECT_EQ(output[3].g, 0);
+}
+
+TEST_F(RgbMatrixCompositing, ReactiveOverlayAddsOverADimmedBase) {
+    rgb_matrix_set_layer_blend(RGB_MATRIX_LAYER_BASE, RGB_MATRIX_BLEND_NORMAL, 63);
+    rgb_matrix_overlay_mode_noeeprom(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    EXPECT_EQ(rgb_matrix_get_overlay_mode(), RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    render_frame();
+    EXPECT_EQ(output[2].r, 63);
+
+    rgb_matrix_handle_key_event(0, 2, true);
+    render_frame();
+    EXPECT_EQ(output[0].r, 63);
+    EXPECT_GT(output[2].r, 200);
+}
+
+TEST_F(RgbMatrixCompositing, OverlayGoesDarkWithTheMatrix) {
+    rgb_matrix_overlay_mode_noeeprom(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    rgb_matrix_handle_key_event(0, 1, true);
+    render_frame();
+    EXPECT_GT(output[1].r, 200);
+
+    rgb_matrix_disable_noeeprom();
+    render_frame();
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        EXPECT_EQ(output[led].r, 0);
+        EXPECT_EQ(output[led].g, 0);
+        EXPECT_EQ(output[led].b, 0);
+    }
+}
+
+TEST_F(RgbMatrixCompositing, OverlayMatchingTheBaseEffectIsSkipped) {
+    rgb_matrix_set_layer_blend(RGB_MATRIX_LAYER_BASE, RGB_MATRIX_BLEND_NORMAL, 63);
+    rgb_matrix_overlay_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    render_frame();
+    EXPECT_EQ(output[0].r, 63);
+}
@@ -0,0 +1,41 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix_test_host.hpp"
+
+static uint32_t conversions;
+
+extern "C" {
+// A keyboard-level colour correction, which swaps red and blue
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    rgb_t rgb = hsv_to_rgb(hsv);
+    conversions++;
+    return (rgb_t){rgb.b, rgb.g, rgb.r};
+}
+}
+
+TEST(RgbMatrixHsvOverride, BatchedEffectsUseTheOverride) {
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        g_led_config.matrix_co[0][led] = led;
+        g_led_config.point[led].x      = 224 * led / (RGB_MATRIX_LED_COUNT - 1);
+        g_led_config.point[led].y      = 32;
+        g_led_config.flags[led]        = LED_FLAG_KEYLIGHT;
+    }
+    set_time(0);
+    rgb_matrix_init();
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_ALL);
+    rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    rgb_matrix_set_speed_noeeprom(0);
+
+    // Render a couple of frames, so the effect is past its init frame
+    render_frame();
+    render_frame();
+
+    // The hue only starts to move after 256ms at the lowest speed, so every LED is pure red before correction
+    EXPECT_GE(conversions, RGB_MATRIX_LED_COUNT);
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        EXPECT_EQ(output[led].r, 0);
+        EXPECT_EQ(output[led].b, 255);
+    }
+}
@@ -0,0 +1,90 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix_test_host.hpp"
+
+// clang-format off
+#define ROW16(f, b) f(b + 0), f(b + 1), f(b + 2), f(b + 3), f(b + 4), f(b + 5), f(b + 6), f(b + 7), \
+                    f(b + 8), f(b + 9), f(b + 10), f(b + 11), f(b + 12), f(b + 13), f(b + 14), f(b + 15)
+#define TABLE(f) ROW16(f, 0), ROW16(f, 16), ROW16(f, 32), ROW16(f, 48), ROW16(f, 64), ROW16(f, 80), ROW16(f, 96), ROW16(f, 112), \
+                 ROW16(f, 128), ROW16(f, 144), ROW16(f, 160), ROW16(f, 176), ROW16(f, 192), ROW16(f, 208), ROW16(f, 224), ROW16(f, 240)
+#define IDENTITY(x) (x)
+#define HALF(x) ((x) / 2)
+#define INVERT(x) (255 - (x))
+// clang-format on
+
+extern "C" {
+const uint8_t g_rgb_matrix_gamma[3][256] = {{TABLE(IDENTITY)}, {TABLE(HALF)}, {TABLE(INVERT)}};
+
+const rgb_t g_rgb_matrix_calibration[RGB_MATRIX_LED_COUNT] = {
+    {255, 255, 255},
+    {128, 255, 255},
+    {255, 128, 255},
+    {255, 255, 0},
+};
+}
+
+class RgbMatrixPostProcess : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        rgb_matrix_set_color_all(0, 0, 0);
+        rgb_matrix_update_pwm_buffers();
+    }
+};
+
+TEST_F(RgbMatrixPostProcess, AppliesGammaAndCalibrationPerLed) {
+    // Blue is inverted by the gamma table, so 255 blue is dark
+    rgb_matrix_set_color(0, 100, 100, 255);
+    rgb_matrix_set_color(1, 100, 100, 255);
+    rgb_matrix_set_color(2, 100, 100, 255);
+    rgb_matrix_set_color(3, 100, 100, 200);
+    rgb_matrix_update_pwm_buffers();
+
+    // gamma: red unchanged, green halved, blue inverted
+    EXPECT_EQ(output[0].r, 100);
+    EXPECT_EQ(output[0].g, 50);
+    EXPECT_EQ(output[0].b, 0);
+    // then scaled by each LED's calibration
+    EXPECT_EQ(output[1].r, 50);
+    EXPECT_EQ(output[2].g, 25);
+    EXPECT_EQ(output[3].b, 0);
+}
+
+TEST_F(RgbMatrixPostProcess, KeepsEffectColorsUntilFlushed) {
+    rgb_matrix_set_color(0, 10, 20, 30);
+    EXPECT_EQ(output[0].r, 0);
+    EXPECT_EQ(output[0].g, 0);
+    EXPECT_EQ(output[0].b, 255);
+
+    rgb_matrix_update_pwm_buffers();
+    EXPECT_EQ(output[0].r, 10);
+    EXPECT_EQ(output[0].g, 10);
+    EXPECT_EQ(output[0].b, 225);
+}
+
+TEST_F(RgbMatrixPostProcess, StaysUnderCurrentLimit) {
+    rgb_matrix_set_color_all(255, 255, 255);
+    rgb_matrix_update_pwm_buffers();
+
+    uint32_t total = 0;
+    for (const rgb_t &led : output) {
+        total += led.r + led.g + led.b;
+    }
+    EXPECT_LE(total * RGB_MATRIX_LED_CURRENT, (uint32_t)RGB_MATRIX_CURRENT_LIMIT * 255);
+    // but is only scaled down as far as needed
+    EXPECT_GT(total * RGB_MATRIX_LED_CURRENT, (uint32_t)RGB_MATRIX_CURRENT_LIMIT * 255 * 9 / 10);
+    EXPECT_GT(output[0].r, output[1].r);
+}
+
+TEST_F(RgbMatrixPostProcess, LeavesFramesUnderTheLimitAlone) {
+    rgb_matrix_set_color(0, 255, 0, 255);
+    rgb_matrix_update_pwm_buffers();
+    EXPECT_EQ(output[0].r, 255);
+}
+
+TEST_F(RgbMatrixPostProcess, WritesEachLedOncePerFlush) {
+    rgb_matrix_set_color_all(255, 255, 255);
+    write_count = 0;
+    rgb_matrix_update_pwm_buffers();
+    EXPECT_EQ(write_count, RGB_MATRIX_LED_COUNT);
+}
@@ -0,0 +1,314 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Renders every enabled effect headlessly against the capturing LED driver.
+ *
+ * Every effect's frames are checked against a golden hash. Set
+ * RGB_MATRIX_RENDER_DUMP to a directory to write the rendered frames of
+ * each effect to <effect>.rgb, as RGB_MATRIX_RENDER_FRAMES frames of
+ * RGB_MATRIX_LED_COUNT raw r, g, b triplets, when checking any change to
+ * the expected values.
+ * The time spent rendering each effect, and the cost of a task loop with
+ * the lighting on and with it dark, are reported by the disabled benchmarks.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "rgb_matrix_test_host.hpp"
+
+extern "C" {
+#include "lib/lib8tion/lib8tion.h"
+}
+
+#ifndef RGB_MATRIX_RENDER_FRAMES
+#    define RGB_MATRIX_RENDER_FRAMES 64
+#endif
+
+// clang-format off
+static const char *effect_names[] = {
+    "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+// clang-format on
+
+struct render_golden {
+    const char *name;
+    uint32_t    hash;
+};
+
+// Golden hashes of the frames rendered by each effect
+// clang-format off
+static const render_golden render_goldens[] = {
+    {"SOLID_COLOR",               0x1CEDB445},
+    {"ALPHAS_MODS",               0x1CEDB445},
+    {"GRADIENT_UP_DOWN",          0x88A65E45},
+    {"GRADIENT_LEFT_RIGHT",       0x62DD51C5},
+    {"BREATHING",                 0x31AA5537},
+    {"BAND_SAT",                  0x5F18EE56},
+    {"BAND_VAL",                  0xF423DEA3},
+    {"BAND_PINWHEEL_SAT",         0x814BED2F},
+    {"BAND_PINWHEEL_VAL",         0x155906E4},
+    {"BAND_SPIRAL_SAT",           0xBF70E266},
+    {"BAND_SPIRAL_VAL",           0x26C825D7},
+    {"CYCLE_ALL",                 0xAFE69A59},
+    {"CYCLE_LEFT_RIGHT",          0x5CC820A7},
+    {"CYCLE_UP_DOWN",             0x9C9297C1},
+    {"RAINBOW_MOVING_CHEVRON",    0xD336C903},
+    {"CYCLE_OUT_IN",              0xEF827D09},
+    {"CYCLE_OUT_IN_DUAL",         0x01CAE019},
+    {"CYCLE_PINWHEEL",            0x379B010D},
+    {"CYCLE_SPIRAL",              0x76EBA8CF},
+    {"DUAL_BEACON",               0xC10ACD9B},
+    {"RAINBOW_BEACON",            0xFF553C39},
+    {"RAINBOW_PINWHEELS",         0xC00BB77D},
+    {"FLOWER_BLOOMING",           0xAE22E47F},
+    {"RAINDROPS",                 0x12C56DB7},
+    {"JELLYBEAN_RAINDROPS",       0xD2493B00},
+    {"HUE_BREATHING",             0x03874D5D},
+    {"HUE_PENDULUM",              0x5E103B95},
+    {"HUE_WAVE",                  0x68A27C0D},
+    {"PIXEL_RAIN",                0xCD12752D},
+    {"PIXEL_FLOW",                0xBEE1331D},
+    {"PIXEL_FRACTAL",             0x17FB8C75},
+    {"TYPING_HEATMAP",            0xF5304BB1},
+    {"DIGITAL_RAIN",              0x1FF02C9C},
+    {"SOLID_REACTIVE_SIMPLE",     0x04F61919},
+    {"SOLID_REACTIVE",            0xC2330DA5},
+    {"SOLID_REACTIVE_WIDE",       0x7325EEEB},
+    {"SOLID_REACTIVE_MULTIWIDE",  0x84A5D3FB},
+    {"SOLID_REACTIVE_CROSS",      0xE68B6B7B},
+    {"SOLID_REACTIVE_MULTICROSS", 0x8D8E8494},
+    {"SOLID_REACTIVE_NEXUS",      0x75107E4F},
+    {"SOLID_REACTIVE_MULTINEXUS", 0x18EF6EE5},
+    {"SPLASH",                    0x1BFF6F01},
+    {"MULTISPLASH",               0xFE9057C7},
+    {"SOLID_SPLASH",              0x5AA13DF7},
+    {"SOLID_MULTISPLASH",         0x28853BC5},
+    {"STARLIGHT_SMOOTH",          0x26BE8854},
+    {"STARLIGHT",                 0x097C81C3},
+    {"STARLIGHT_DUAL_SAT",        0x0B9579A4},
+    {"STARLIGHT_DUAL_HUE",        0x79A6D7D9},
+    {"RIVERFLOW",                 0xD9C79951},
+    {"PARTICLE_SPARKS",           0x9E0EF24B},
+    {"PARTICLE_RIPPLE",           0x5014FF64},
+};
+// clang-format on
+
+class RgbMatrixRender : public ::testing::Test {
+   protected:
+    // One LED per key, spread evenly over the 224x64 grid
+    static void SetUpTestSuite() {
+        uint8_t led = 0;
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if (led < RGB_MATRIX_LED_COUNT) {
+                    g_led_config.matrix_co[row][col] = led;
+                    g_led_config.point[led].x        = MATRIX_COLS > 1 ? 224 * col / (MATRIX_COLS - 1) : 112;
+                    g_led_config.point[led].y        = MATRIX_ROWS > 1 ? 64 * row / (MATRIX_ROWS - 1) : 32;
+                    g_led_config.flags[led]          = LED_FLAG_KEYLIGHT;
+                    led++;
+                } else {
+                    g_led_config.matrix_co[row][col] = NO_LED;
+                }
+            }
+        }
+        // Any remaining LEDs become underglow around the edge
+        for (; led < RGB_MATRIX_LED_COUNT; led++) {
+            g_led_config.point[led].x = 224 * (led % 8) / 7;
+            g_led_config.point[led].y = (led & 8) ? 64 : 0;
+            g_led_config.flags[led]   = LED_FLAG_UNDERGLOW;
+        }
+
+        rgb_matrix_init();
+    }
+
+    struct render_result_t {
+        std::vector<uint8_t> frames;
+        double               ns;
+    };
+
+    // Renders RGB_MATRIX_RENDER_FRAMES frames of an effect from a known starting state
+    static render_result_t render(uint8_t mode) {
+        using clock = std::chrono::steady_clock;
+
+        render_result_t result = {};
+        result.frames.reserve(RGB_MATRIX_RENDER_FRAMES * sizeof(output));
+
+        set_time(0);
+        rgb_matrix_init();
+
+        // Flush one dark frame so the effect sees params->init on its first frame,
+        // even when the previous render used the same mode
+        rgb_matrix_disable_noeeprom();
+        for (uint32_t flushes = flush_count; flushes == flush_count;) {
+            rgb_matrix_task();
+            advance_time(1);
+        }
+
+        srand(0);
+        random16_set_seed(1337);
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_set_speed_noeeprom(128);
+        rgb_matrix_mode_noeeprom(mode);
+        memset(output, 0, sizeof(output));
+
+        uint32_t rendered = 0;
+        while (rendered < RGB_MATRIX_RENDER_FRAMES) {
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+            // Give the reactive effects a couple of keypresses to work with
+            if (rendered % 16 == 0) {
+                uint8_t row = (rendered / 16) % MATRIX_ROWS;
+                uint8_t col = (rendered / 16 * 3) % MATRIX_COLS;
+                rgb_matrix_handle_key_event(row, col, true);
+                rgb_matrix_handle_key_event(row, col, false);
+            }
+#endif
+            uint32_t flushes = flush_count;
+
+            auto start = clock::now();
+            rgb_matrix_task();
+            result.ns += std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+            if (flush_count != flushes) {
+                const uint8_t *bytes = reinterpret_cast<const uint8_t *>(output);
+                result.frames.insert(result.frames.end(), bytes, bytes + sizeof(output));
+                rendered++;
+            }
+            advance_time(1);
+        }
+
+        return result;
+    }
+
+    // 32-bit FNV-1a hash of the rendered frames
+    static uint32_t hash(const std::vector<uint8_t> &frames) {
+        uint32_t h = 0x811C9DC5;
+        for (uint8_t c : frames) {
+            h = (h ^ c) * 0x01000193;
+        }
+        return h;
+    }
+
+    static std::string path(const char *dir, uint8_t mode) {
+        return std::string(dir) + "/" + effect_names[mode] + ".rgb";
+    }
+};
+
+TEST_F(RgbMatrixRender, RendersEveryEffect) {
+    const char *dump_dir = getenv("RGB_MATRIX_RENDER_DUMP");
+
+    for (uint8_t mode = 1; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        SCOPED_TRACE(effect_names[mode]);
+        render_result_t result = render(mode);
+        ASSERT_EQ(result.frames.size(), RGB_MATRIX_RENDER_FRAMES * sizeof(output));
+
+        if (dump_dir) {
+            std::ofstream out(path(dump_dir, mode), std::ios::binary);
+            out.write(reinterpret_cast<const char *>(result.frames.data()), result.frames.size());
+            EXPECT_TRUE(out.good()) << "could not write " << path(dump_dir, mode);
+        }
+
+        uint32_t actual = hash(result.frames);
+        auto     golden = std::find_if(std::begin(render_goldens), std::end(render_goldens), [mode](const render_golden &g) { return strcmp(g.name, effect_names[mode]) == 0; });
+        if (golden == std::end(render_goldens)) {
+            ADD_FAILURE() << "missing golden hash " << std::hex << std::showbase << actual;
+            continue;
+        }
+        EXPECT_EQ(actual, golden->hash) << std::hex << std::showbase << actual;
+    }
+}
+
+// Run with --gtest_also_run_disabled_tests to print how long each effect takes to render
+TEST_F(RgbMatrixRender, DISABLED_Benchmark) {
+    std::cout << std::left << std::setw(32) << "effect" << std::right << std::setw(12) << "ns/frame" << std::setw(12) << "ns/LED" << std::endl;
+
+    for (uint8_t mode = 1; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        render_result_t result       = render(mode);
+        double          ns_per_frame = result.ns / RGB_MATRIX_RENDER_FRAMES;
+        std::cout << std::left << std::setw(32) << effect_names[mode] << std::right << std::fixed << std::setprecision(0) << std::setw(12) << ns_per_frame << std::setprecision(1) << std::setw(12) << ns_per_frame / RGB_MATRIX_LED_COUNT << std::endl;
+    }
+}
+
+TEST_F(RgbMatrixRender, RenderingIsDeterministic) {
+    for (uint8_t mode = 1; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        render_result_t first  = render(mode);
+        render_result_t second = render(mode);
+        EXPECT_EQ(first.frames, second.frames) << effect_names[mode];
+    }
+}
+
+TEST_F(RgbMatrixRender, SleepsWhileDark) {
+    render(RGB_MATRIX_SOLID_COLOR);
+
+    // The first dark frame is flushed, then the driver is shut down exactly once
+    uint32_t shutdowns = shutdown_count;
+    rgb_matrix_disable_noeeprom();
+    for (uint32_t i = 0; i < 1000 && shutdown_count == shutdowns; i++) {
+        rgb_matrix_task();
+        advance_time(1);
+    }
+    ASSERT_EQ(shutdown_count, shutdowns + 1);
+    for (const rgb_t &led : output) {
+        EXPECT_EQ(led.r | led.g | led.b, 0);
+    }
+
+    // While dark nothing is rendered, written or flushed
+    uint32_t writes  = write_count;
+    uint32_t flushes = flush_count;
+    uint32_t wakeups = wakeup_count;
+    for (uint32_t i = 0; i < 1000; i++) {
+        rgb_matrix_task();
+        advance_time(1);
+    }
+    EXPECT_EQ(write_count, writes);
+    EXPECT_EQ(flush_count, flushes);
+    EXPECT_EQ(shutdown_count, shutdowns + 1);
+    EXPECT_EQ(wakeup_count, wakeups);
+
+    // Lighting comes back on the very next task call
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_task();
+    EXPECT_EQ(wakeup_count, wakeups + 1);
+    for (uint32_t i = 0; i < 1000 && flush_count == flushes; i++) {
+        advance_time(1);
+        rgb_matrix_task();
+    }
+    EXPECT_NE(flush_count, flushes);
+    EXPECT_NE(output[0].r | output[0].g | output[0].b, 0);
+}
+
+// Run with --gtest_also_run_disabled_tests to print the cost of a task loop with the lighting on and with it dark
+TEST_F(RgbMatrixRender, DISABLED_DarkBenchmark) {
+    using clock = std::chrono::steady_clock;
+
+    auto run = [](uint32_t loops) {
+        auto start = clock::now();
+        for (uint32_t i = 0; i < loops; i++) {
+            rgb_matrix_task();
+            advance_time(1);
+        }
+        return std::chrono::duration<double, std::nano>(clock::now() - start).count() / loops;
+    };
+
+    render(RGB_MATRIX_SOLID_COLOR);
+    double lit = run(10000);
+
+    rgb_matrix_disable_noeeprom();
+    run(1000);
+    double dark = run(10000);
+
+    std::cout << "task loop: " << std::fixed << std::setprecision(1) << lit << " ns lit, " << dark << " ns dark" << std::endl;
+}
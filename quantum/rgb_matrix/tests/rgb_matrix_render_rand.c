@@ -0,0 +1,22 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * A few effects seed themselves from rand(). Replace the C library's
+ * generator with a fixed LCG so the golden hashes in rgb_matrix_render.cpp
+ * don't depend on the host's libc.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+static uint32_t rand_state = 1;
+
+void srand(unsigned int seed) {
+    rand_state = seed;
+}
+
+int rand(void) {
+    rand_state = rand_state * 1103515245 + 12345;
+    return (int)((rand_state >> 1) % ((uint32_t)RAND_MAX + 1));
+}
@@ -0,0 +1,97 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "eeconfig.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+void set_time(uint32_t t);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Capturing LED driver
+
+// The last colour written to each LED, and counts of the calls made to the driver
+static rgb_t    output[RGB_MATRIX_LED_COUNT];
+static uint32_t write_count;
+static uint32_t flush_count;
+static uint32_t shutdown_count;
+static uint32_t wakeup_count;
+
+static void capture_init(void) {}
+
+static void capture_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    write_count++;
+    output[index] = {r, g, b};
+}
+
+static void capture_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    write_count++;
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        output[i] = {r, g, b};
+    }
+}
+
+static void capture_flush(void) {
+    flush_count++;
+}
+
+static void capture_shutdown(void) {
+    shutdown_count++;
+}
+
+static void capture_wakeup(void) {
+    wakeup_count++;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Keyboard-level stubs
+
+static rgb_config_t eeprom_config;
+
+extern "C" {
+extern const rgb_matrix_driver_t rgb_matrix_driver;
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = capture_init,
+    .set_color     = capture_set_color,
+    .set_color_all = capture_set_color_all,
+    .flush         = capture_flush,
+    .shutdown      = capture_shutdown,
+    .wakeup        = capture_wakeup,
+};
+
+led_config_t g_led_config;
+
+void eeconfig_read_rgb_matrix(rgb_config_t *config) {
+    *config = eeprom_config;
+}
+
+void eeconfig_update_rgb_matrix(const rgb_config_t *config) {
+    eeprom_config = *config;
+}
+
+bool is_keyboard_master(void) {
+    return true;
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+// Runs the task until a frame has been flushed, returning how long it took to come round, one millisecond per task run
+static inline uint32_t render_frame(void) {
+    uint32_t flushed = flush_count;
+    uint32_t start   = timer_read32();
+    for (int i = 0; i < 1000 && flush_count == flushed; i++) {
+        advance_time(1);
+        rgb_matrix_task();
+    }
+    EXPECT_NE(flush_count, flushed);
+    return timer_elapsed32(start);
+}
@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix_test_host.hpp"
+
+extern "C" {
+extern uint32_t keyframe_probe_evaluations;
+extern uint16_t keyframe_probe_delta;
+}
+
+class RgbMatrixTiming : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+            g_led_config.point[led].x = 224 * led / (RGB_MATRIX_LED_COUNT - 1);
+            g_led_config.point[led].y = 32;
+            g_led_config.flags[led]   = LED_FLAG_KEYLIGHT;
+        }
+        rgb_matrix_init();
+    }
+
+    void SetUp() override {
+        set_time(0);
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 0, 255);
+        rgb_matrix_set_speed_noeeprom(128);
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_CUSTOM_KEYFRAME_PROBE);
+        render_frame();
+        keyframe_probe_evaluations = 0;
+    }
+};
+
+TEST_F(RgbMatrixTiming, EffectsSeeTheTimeBetweenFrames) {
+    render_frame();
+    uint32_t period = render_frame();
+    EXPECT_EQ(keyframe_probe_delta, period);
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    render_frame();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CUSTOM_KEYFRAME_PROBE);
+    render_frame();
+    EXPECT_EQ(keyframe_probe_delta, 0);
+}
+
+TEST_F(RgbMatrixTiming, KeyframesAreInterpolated) {
+    uint32_t frames = 0;
+    uint8_t  last   = output[0].r;
+    while (timer_read32() < 1000) {
+        render_frame();
+        frames++;
+        EXPECT_GE(output[0].r, last);
+        EXPECT_LE(output[0].r - last, 8);
+        last = output[0].r;
+    }
+
+    // the effect function only runs for each keyframe, not each frame
+    EXPECT_LE(keyframe_probe_evaluations, (1000 / RGB_MATRIX_KEYFRAME_INTERVAL + 2) * RGB_MATRIX_LED_COUNT);
+    EXPECT_GT(frames * RGB_MATRIX_LED_COUNT, keyframe_probe_evaluations * 2);
+}
+
+TEST_F(RgbMatrixTiming, ReportsFrameRatePerEffect) {
+    while (timer_read32() < 1100) {
+        render_frame();
+    }
+    rgb_matrix_render_stats_t stats = rgb_matrix_get_render_stats();
+    EXPECT_EQ(stats.mode, RGB_MATRIX_CUSTOM_KEYFRAME_PROBE);
+    EXPECT_GT(stats.fps, 0);
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    render_frame();
+    stats = rgb_matrix_get_render_stats();
+    EXPECT_EQ(stats.mode, RGB_MATRIX_SOLID_COLOR);
+    EXPECT_EQ(stats.fps, 0);
+}
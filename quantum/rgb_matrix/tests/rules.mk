@@ -0,0 +1,199 @@
+rgb_matrix_render_DEFS := \
+	-DNO_DEBUG \
+	-DRGB_MATRIX_ENABLE \
+	-DMATRIX_ROWS=5 \
+	-DMATRIX_COLS=14 \
+	-DRGB_MATRIX_LED_COUNT=78 \
+	-DENABLE_RGB_MATRIX_ALPHAS_MODS \
+	-DENABLE_RGB_MATRIX_BAND_PINWHEEL_SAT \
+	-DENABLE_RGB_MATRIX_BAND_PINWHEEL_VAL \
+	-DENABLE_RGB_MATRIX_BAND_SAT \
+	-DENABLE_RGB_MATRIX_BAND_SPIRAL_SAT \
+	-DENABLE_RGB_MATRIX_BAND_SPIRAL_VAL \
+	-DENABLE_RGB_MATRIX_BAND_VAL \
+	-DENABLE_RGB_MATRIX_BREATHING \
+	-DENABLE_RGB_MATRIX_CYCLE_ALL \
+	-DENABLE_RGB_MATRIX_CYCLE_LEFT_RIGHT \
+	-DENABLE_RGB_MATRIX_CYCLE_OUT_IN \
+	-DENABLE_RGB_MATRIX_CYCLE_OUT_IN_DUAL \
+	-DENABLE_RGB_MATRIX_CYCLE_PINWHEEL \
+	-DENABLE_RGB_MATRIX_CYCLE_SPIRAL \
+	-DENABLE_RGB_MATRIX_CYCLE_UP_DOWN \
+	-DENABLE_RGB_MATRIX_DIGITAL_RAIN \
+	-DENABLE_RGB_MATRIX_DUAL_BEACON \
+	-DENABLE_RGB_MATRIX_FLOWER_BLOOMING \
+	-DENABLE_RGB_MATRIX_GRADIENT_LEFT_RIGHT \
+	-DENABLE_RGB_MATRIX_GRADIENT_UP_DOWN \
+	-DENABLE_RGB_MATRIX_HUE_BREATHING \
+	-DENABLE_RGB_MATRIX_HUE_PENDULUM \
+	-DENABLE_RGB_MATRIX_HUE_WAVE \
+	-DENABLE_RGB_MATRIX_JELLYBEAN_RAINDROPS \
+	-DENABLE_RGB_MATRIX_MULTISPLASH \
+	-DENABLE_RGB_MATRIX_PARTICLE_RIPPLE \
+	-DENABLE_RGB_MATRIX_PARTICLE_SPARKS \
+	-DENABLE_RGB_MATRIX_PIXEL_FLOW \
+	-DENABLE_RGB_MATRIX_PIXEL_FRACTAL \
+	-DENABLE_RGB_MATRIX_PIXEL_RAIN \
+	-DENABLE_RGB_MATRIX_RAINBOW_BEACON \
+	-DENABLE_RGB_MATRIX_RAINBOW_MOVING_CHEVRON \
+	-DENABLE_RGB_MATRIX_RAINBOW_PINWHEELS \
+	-DENABLE_RGB_MATRIX_RAINDROPS \
+	-DENABLE_RGB_MATRIX_RIVERFLOW \
+	-DENABLE_RGB_MATRIX_SOLID_MULTISPLASH \
+	-DENABLE_RGB_MATRIX_SOLID_REACTIVE \
+	-DENABLE_RGB_MATRIX_SOLID_REACTIVE_CROSS \
+	-DENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTICROSS \
+	-DENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTINEXUS \
+	-DENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE \
+	-DENABLE_RGB_MATRIX_SOLID_REACTIVE_NEXUS \
+	-DENABLE_RGB_MATRIX_SOLID_REACTIVE_SIMPLE \
+	-DENABLE_RGB_MATRIX_SOLID_REACTIVE_WIDE \
+	-DENABLE_RGB_MATRIX_SOLID_SPLASH \
+	-DENABLE_RGB_MATRIX_SPLASH \
+	-DENABLE_RGB_MATRIX_STARLIGHT \
+	-DENABLE_RGB_MATRIX_STARLIGHT_DUAL_HUE \
+	-DENABLE_RGB_MATRIX_STARLIGHT_DUAL_SAT \
+	-DENABLE_RGB_MATRIX_STARLIGHT_SMOOTH \
+	-DENABLE_RGB_MATRIX_TYPING_HEATMAP
+
+rgb_matrix_render_CONFIG := $(QUANTUM_PATH)/rgb_matrix/post_config.h
+
+rgb_matrix_render_INC := \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners
+
+rgb_matrix_render_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_render.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_render_rand.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+rgb_matrix_post_process_DEFS := \
+	-DNO_DEBUG \
+	-DRGB_MATRIX_ENABLE \
+	-DMATRIX_ROWS=1 \
+	-DMATRIX_COLS=4 \
+	-DRGB_MATRIX_LED_COUNT=4 \
+	-DRGB_MATRIX_GAMMA_CORRECTION \
+	-DRGB_MATRIX_LED_CALIBRATION \
+	-DRGB_MATRIX_CURRENT_LIMIT=60 \
+	-DRGB_MATRIX_LED_CURRENT=20
+
+rgb_matrix_post_process_CONFIG := $(QUANTUM_PATH)/rgb_matrix/post_config.h
+
+rgb_matrix_post_process_INC := \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners
+
+rgb_matrix_post_process_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_post_process.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+rgb_matrix_compositing_DEFS := \
+	-DNO_DEBUG \
+	-DRGB_MATRIX_ENABLE \
+	-DMATRIX_ROWS=1 \
+	-DMATRIX_COLS=4 \
+	-DRGB_MATRIX_LED_COUNT=4 \
+	-DRGB_MATRIX_COMPOSITING \
+	-DENABLE_RGB_MATRIX_SOLID_REACTIVE_SIMPLE
+
+rgb_matrix_compositing_CONFIG := $(QUANTUM_PATH)/rgb_matrix/post_config.h
+
+rgb_matrix_compositing_INC := \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners
+
+rgb_matrix_compositing_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_compositing.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+rgb_matrix_timing_DEFS := \
+	-DNO_DEBUG \
+	-DRGB_MATRIX_ENABLE \
+	-DMATRIX_ROWS=1 \
+	-DMATRIX_COLS=4 \
+	-DRGB_MATRIX_LED_COUNT=4 \
+	-DRGB_MATRIX_CUSTOM_USER \
+	-DRGB_MATRIX_KEYFRAME_EFFECTS \
+	-DRGB_MATRIX_KEYFRAME_INTERVAL=64 \
+	-DRGB_MATRIX_RENDER_STATS
+
+rgb_matrix_timing_CONFIG := $(QUANTUM_PATH)/rgb_matrix/post_config.h
+
+rgb_matrix_timing_INC := \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners \
+	$(QUANTUM_PATH)/rgb_matrix/tests
+
+rgb_matrix_timing_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_timing.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+rgb_matrix_hsv_override_DEFS := \
+	-DNO_DEBUG \
+	-DRGB_MATRIX_ENABLE \
+	-DMATRIX_ROWS=1 \
+	-DMATRIX_COLS=4 \
+	-DRGB_MATRIX_LED_COUNT=4 \
+	-DENABLE_RGB_MATRIX_CYCLE_ALL
+
+rgb_matrix_hsv_override_CONFIG := $(QUANTUM_PATH)/rgb_matrix/post_config.h
+
+rgb_matrix_hsv_override_INC := \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners
+
+rgb_matrix_hsv_override_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_hsv_override.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+rgb_matrix_adaptive_DEFS := \
+	-DNO_DEBUG \
+	-DRGB_MATRIX_ENABLE \
+	-DMATRIX_ROWS=4 \
+	-DMATRIX_COLS=16 \
+	-DRGB_MATRIX_LED_COUNT=64 \
+	-DRGB_MATRIX_LED_PROCESS_LIMIT=32 \
+	-DRGB_MATRIX_LED_PROCESS_ADAPTIVE \
+	-DRGB_MATRIX_CUSTOM_USER
+
+rgb_matrix_adaptive_CONFIG := $(QUANTUM_PATH)/rgb_matrix/post_config.h
+
+rgb_matrix_adaptive_INC := \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners \
+	$(QUANTUM_PATH)/rgb_matrix/tests
+
+rgb_matrix_adaptive_SRC := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_adaptive.cpp \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/color.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
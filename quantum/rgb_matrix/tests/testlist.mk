@@ -0,0 +1,6 @@
+TEST_LIST += rgb_matrix_render
+TEST_LIST += rgb_matrix_post_process
+TEST_LIST += rgb_matrix_compositing
+TEST_LIST += rgb_matrix_timing
+TEST_LIST += rgb_matrix_hsv_override
+TEST_LIST += rgb_matrix_adaptive
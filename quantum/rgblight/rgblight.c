@@ -146,8 +146,33 @@ uint8_t rgblight_led_index(uint8_t index) {
 #endif
 }
 
+#ifdef RGBLIGHT_USE_TIMER
+// The animation frame being rendered, see rgblight_render_frame()
+static struct {
+    bool  active;
+    bool  set_pending;
+    bool  dirty;                    // whether the LEDs differ from what was last flushed
+    rgb_t leds[RGBLIGHT_LED_COUNT]; // a copy of everything written to the driver
+} rgblight_frame = {.dirty = true};
+#endif
+
+static inline void rgblight_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+#ifdef RGBLIGHT_USE_TIMER
+    if (index >= 0 && index < RGBLIGHT_LED_COUNT) {
+        rgb_t *led = &rgblight_frame.leds[index];
+        if (led->r != r || led->g != g || led->b != b) {
+            *led                 = (rgb_t){r, g, b};
+            rgblight_frame.dirty = true;
+        }
+    } else {
+        rgblight_frame.dirty = true;
+    }
+#endif
+    rgblight_driver.set_color(index, r, g, b);
+}
+
 void setrgb(uint8_t r, uint8_t g, uint8_t b, int index) {
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    rgblight_set_color(rgblight_led_index(index), r, g, b);
 }
 
 void sethsv_raw(uint8_t hue, uint8_t sat, uint8_t val, int index) {
@@ -628,7 +653,7 @@ void rgblight_setrgb(uint8_t r, uint8_t g, uint8_t b) {
     }
 
     for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        rgblight_set_color(rgblight_led_index(i), r, g, b);
     }
     rgblight_set();
 }
@@ -638,7 +663,7 @@ void rgblight_setrgb_at(uint8_t r, uint8_t g, uint8_t b, uint8_t index) {
         return;
     }
 
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    rgblight_set_color(rgblight_led_index(index), r, g, b);
     rgblight_set();
 }
 
@@ -669,7 +694,7 @@ void rgblight_setrgb_range(uint8_t r, uint8_t g, uint8_t b, uint8_t start, uint8
     }
 
     for (uint8_t i = start; i < end; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        rgblight_set_color(rgblight_led_index(i), r, g, b);
     }
     rgblight_set();
 }
@@ -859,9 +884,17 @@ void rgblight_wakeup(void) {
 #endif
 
 void rgblight_set(void) {
+#ifdef RGBLIGHT_USE_TIMER
+    if (rgblight_frame.active) {
+        // Deferred until the frame is complete, and skipped if nothing changed
+        rgblight_frame.set_pending = true;
+        return;
+    }
+#endif
+
     if (!rgblight_config.enable) {
         for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-            rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+            rgblight_set_color(rgblight_led_index(i), 0, 0, 0);
         }
     }
 
@@ -878,6 +911,9 @@ void rgblight_set(void) {
 #endif
 
     rgblight_driver.flush();
+#ifdef RGBLIGHT_USE_TIMER
+    rgblight_frame.dirty = false;
+#endif
 }
 
 #ifdef RGBLIGHT_SPLIT
@@ -935,6 +971,18 @@ void rgblight_update_sync(rgblight_syncinfo_t *syncinfo, bool write_to_eeprom) {
 
 typedef void (*effect_func_t)(animation_status_t *anim);
 
+#    ifdef RGBLIGHT_EFFECT_STATS
+static rgblight_effect_stats_t effect_stats;
+static uint16_t                effect_stats_frames;
+static uint16_t                effect_stats_flushes;
+static uint16_t                effect_stats_render_ms;
+static uint32_t                effect_stats_window_start;
+
+rgblight_effect_stats_t rgblight_get_effect_stats(void) {
+    return effect_stats;
+}
+#    endif
+
 // Animation timer -- use system timer (AVR Timer0)
 void rgblight_timer_init(void) {
     rgblight_status.timer_enabled = false;
@@ -980,77 +1028,169 @@ static void rgblight_effect_dummy(animation_status_t *anim) {
     **/
 }
 
-void rgblight_timer_task(void) {
-    if (rgblight_status.timer_enabled) {
-        effect_func_t effect_func   = rgblight_effect_dummy;
-        uint16_t      interval_time = 2000; // dummy interval
-        uint8_t       delta         = rgblight_config.mode - rgblight_status.base_mode;
-        animation_status.delta      = delta;
+static uint16_t rgblight_interval_dummy(uint8_t delta) {
+    return 2000;
+}
 
-        // static light mode, do nothing here
-        if (1 == 0) { // dummy
-        }
 #    ifdef RGBLIGHT_EFFECT_BREATHING
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_BREATHING) {
-            // breathing mode
-            interval_time = get_interval_time(&RGBLED_BREATHING_INTERVALS[delta], 1, 100);
-            effect_func   = rgblight_effect_breathing;
-        }
+static uint16_t rgblight_interval_breathing(uint8_t delta) {
+    return get_interval_time(&RGBLED_BREATHING_INTERVALS[delta], 1, 100);
+}
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RAINBOW_MOOD
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_MOOD) {
-            // rainbow mood mode
-            interval_time = get_interval_time(&RGBLED_RAINBOW_MOOD_INTERVALS[delta], 5, 100);
-            effect_func   = rgblight_effect_rainbow_mood;
-        }
+static uint16_t rgblight_interval_rainbow_mood(uint8_t delta) {
+    return get_interval_time(&RGBLED_RAINBOW_MOOD_INTERVALS[delta], 5, 100);
+}
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RAINBOW_SWIRL
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_SWIRL) {
-            // rainbow swirl mode
-            interval_time = get_interval_time(&RGBLED_RAINBOW_SWIRL_INTERVALS[delta / 2], 1, 100);
-            effect_func   = rgblight_effect_rainbow_swirl;
-        }
+static uint16_t rgblight_interval_rainbow_swirl(uint8_t delta) {
+    return get_interval_time(&RGBLED_RAINBOW_SWIRL_INTERVALS[delta / 2], 1, 100);
+}
 #    endif
 #    ifdef RGBLIGHT_EFFECT_SNAKE
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_SNAKE) {
-            // snake mode
-            interval_time = get_interval_time(&RGBLED_SNAKE_INTERVALS[delta / 2], 1, 200);
-            effect_func   = rgblight_effect_snake;
-        }
+static uint16_t rgblight_interval_snake(uint8_t delta) {
+    return get_interval_time(&RGBLED_SNAKE_INTERVALS[delta / 2], 1, 200);
+}
 #    endif
 #    ifdef RGBLIGHT_EFFECT_KNIGHT
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_KNIGHT) {
-            // knight mode
-            interval_time = get_interval_time(&RGBLED_KNIGHT_INTERVALS[delta], 5, 100);
-            effect_func   = rgblight_effect_knight;
-        }
+static uint16_t rgblight_interval_knight(uint8_t delta) {
+    return get_interval_time(&RGBLED_KNIGHT_INTERVALS[delta], 5, 100);
+}
 #    endif
 #    ifdef RGBLIGHT_EFFECT_CHRISTMAS
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_CHRISTMAS) {
-            // christmas mode
-            interval_time = RGBLIGHT_EFFECT_CHRISTMAS_INTERVAL;
-            effect_func   = (effect_func_t)rgblight_effect_christmas;
-        }
+static uint16_t rgblight_interval_christmas(uint8_t delta) {
+    return RGBLIGHT_EFFECT_CHRISTMAS_INTERVAL;
+}
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RGB_TEST
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RGB_TEST) {
-            // RGB test mode
-            interval_time = pgm_read_word(&RGBLED_RGBTEST_INTERVALS[0]);
-            effect_func   = (effect_func_t)rgblight_effect_rgbtest;
-        }
+static uint16_t rgblight_interval_rgbtest(uint8_t delta) {
+    return pgm_read_word(&RGBLED_RGBTEST_INTERVALS[0]);
+}
 #    endif
 #    ifdef RGBLIGHT_EFFECT_ALTERNATING
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_ALTERNATING) {
-            interval_time = 500;
-            effect_func   = (effect_func_t)rgblight_effect_alternating;
-        }
+static uint16_t rgblight_interval_alternating(uint8_t delta) {
+    return 500;
+}
+#    endif
+#    ifdef RGBLIGHT_EFFECT_TWINKLE
+static uint16_t rgblight_interval_twinkle(uint8_t delta) {
+    return get_interval_time(&RGBLED_TWINKLE_INTERVALS[delta % 3], 5, 30);
+}
+#    endif
+
+typedef uint16_t (*effect_interval_func_t)(uint8_t delta);
+
+typedef struct {
+    uint8_t                base_mode;
+    effect_func_t          func;
+    effect_interval_func_t interval;
+} rgblight_effect_t;
+
+// clang-format off
+static const rgblight_effect_t rgblight_effects[] PROGMEM = {
+#    ifdef RGBLIGHT_EFFECT_BREATHING
+    { RGBLIGHT_MODE_BREATHING,     rgblight_effect_breathing,     rgblight_interval_breathing     },
+#    endif
+#    ifdef RGBLIGHT_EFFECT_RAINBOW_MOOD
+    { RGBLIGHT_MODE_RAINBOW_MOOD,  rgblight_effect_rainbow_mood,  rgblight_interval_rainbow_mood  },
+#    endif
+#    ifdef RGBLIGHT_EFFECT_RAINBOW_SWIRL
+    { RGBLIGHT_MODE_RAINBOW_SWIRL, rgblight_effect_rainbow_swirl, rgblight_interval_rainbow_swirl },
+#    endif
+#    ifdef RGBLIGHT_EFFECT_SNAKE
+    { RGBLIGHT_MODE_SNAKE,         rgblight_effect_snake,         rgblight_interval_snake         },
+#    endif
+#    ifdef RGBLIGHT_EFFECT_KNIGHT
+    { RGBLIGHT_MODE_KNIGHT,        rgblight_effect_knight,        rgblight_interval_knight        },
+#    endif
+#    ifdef RGBLIGHT_EFFECT_CHRISTMAS
+    { RGBLIGHT_MODE_CHRISTMAS,     rgblight_effect_christmas,     rgblight_interval_christmas     },
+#    endif
+#    ifdef RGBLIGHT_EFFECT_RGB_TEST
+    { RGBLIGHT_MODE_RGB_TEST,      rgblight_effect_rgbtest,       rgblight_interval_rgbtest       },
+#    endif
+#    ifdef RGBLIGHT_EFFECT_ALTERNATING
+    { RGBLIGHT_MODE_ALTERNATING,   rgblight_effect_alternating,   rgblight_interval_alternating   },
 #    endif
 #    ifdef RGBLIGHT_EFFECT_TWINKLE
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_TWINKLE) {
-            interval_time = get_interval_time(&RGBLED_TWINKLE_INTERVALS[delta % 3], 5, 30);
-            effect_func   = (effect_func_t)rgblight_effect_twinkle;
+    { RGBLIGHT_MODE_TWINKLE,       rgblight_effect_twinkle,       rgblight_interval_twinkle       },
+#    endif
+};
+// clang-format on
+
+// Effect of the current base mode, so that it is only looked up when the mode changes
+static rgblight_effect_t current_effect = {0, rgblight_effect_dummy, rgblight_interval_dummy};
+
+static void rgblight_effect_lookup(uint8_t base_mode) {
+    current_effect.base_mode = base_mode;
+    current_effect.func      = rgblight_effect_dummy;
+    current_effect.interval  = rgblight_interval_dummy;
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(rgblight_effects); i++) {
+        if (pgm_read_byte(&rgblight_effects[i].base_mode) == base_mode) {
+            memcpy_P(&current_effect, &rgblight_effects[i], sizeof(rgblight_effect_t));
+            break;
         }
+    }
+
+#    ifdef RGBLIGHT_EFFECT_STATS
+    effect_stats.mode         = base_mode;
+    effect_stats.fps          = 0;
+    effect_stats.flushes      = 0;
+    effect_stats.render_ms    = 0;
+    effect_stats_frames       = 0;
+    effect_stats_flushes      = 0;
+    effect_stats_render_ms    = 0;
+    effect_stats_window_start = timer_read32();
+#    endif
+}
+
+/*
+ * Renders a single animation frame. Any rgblight_set() calls made by the
+ * effect are deferred until the frame is complete, and the LEDs are only
+ * flushed if the frame differs from the previous one.
+ */
+static void rgblight_render_frame(effect_func_t effect_func) {
+#    ifdef RGBLIGHT_EFFECT_STATS
+    uint32_t render_start = timer_read32();
+#    endif
+
+    rgblight_frame.active      = true;
+    rgblight_frame.set_pending = false;
+    effect_func(&animation_status);
+    rgblight_frame.active = false;
+
+    bool flush = rgblight_frame.set_pending && rgblight_frame.dirty;
+    if (flush) {
+        rgblight_set();
+    }
+
+#    ifdef RGBLIGHT_EFFECT_STATS
+    uint32_t now = timer_read32();
+    effect_stats_frames++;
+    effect_stats_flushes += flush;
+    effect_stats_render_ms += TIMER_DIFF_32(now, render_start);
+    if (TIMER_DIFF_32(now, effect_stats_window_start) >= 1000) {
+        effect_stats.fps          = effect_stats_frames;
+        effect_stats.flushes      = effect_stats_flushes;
+        effect_stats.render_ms    = effect_stats_render_ms;
+        effect_stats_frames       = 0;
+        effect_stats_flushes      = 0;
+        effect_stats_render_ms    = 0;
+        effect_stats_window_start = now;
+    }
 #    endif
+}
+
+void rgblight_timer_task(void) {
+    if (rgblight_status.timer_enabled) {
+        uint8_t delta          = rgblight_config.mode - rgblight_status.base_mode;
+        animation_status.delta = delta;
+
+        if (current_effect.base_mode != rgblight_status.base_mode) {
+            rgblight_effect_lookup(rgblight_status.base_mode);
+        }
+
         if (animation_status.restart) {
             animation_status.restart    = false;
             animation_status.last_timer = sync_timer_read();
@@ -1072,8 +1212,8 @@ void rgblight_timer_task(void) {
             }
             oldpos16 = animation_status.pos16;
 #    endif
-            animation_status.last_timer += interval_time;
-            effect_func(&animation_status);
+            animation_status.last_timer += current_effect.interval(delta);
+            rgblight_render_frame(current_effect.func);
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
             if (animation_status.pos16 == 0 && oldpos16 != 0) {
                 tick_flag = true;
@@ -1198,7 +1338,7 @@ void rgblight_effect_snake(animation_status_t *anim) {
 #    endif
 
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i + rgblight_ranges.effect_start_pos), 0, 0, 0);
+        rgblight_set_color(rgblight_led_index(i + rgblight_ranges.effect_start_pos), 0, 0, 0);
 
         for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
             k = pos + j * increment;
@@ -1254,7 +1394,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
 #    endif
     // Set all the LEDs to 0
     for (i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+        rgblight_set_color(rgblight_led_index(i), 0, 0, 0);
     }
     // Determine which LEDs should be lit up
     for (i = 0; i < RGBLIGHT_EFFECT_KNIGHT_LED_NUM; i++) {
@@ -1263,7 +1403,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
         if (i >= low_bound && i <= high_bound) {
             sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, cur);
         } else {
-            rgblight_driver.set_color(rgblight_led_index(cur), 0, 0, 0);
+            rgblight_set_color(rgblight_led_index(cur), 0, 0, 0);
         }
     }
     rgblight_set();
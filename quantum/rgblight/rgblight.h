@@ -435,6 +435,17 @@ typedef struct _animation_status_t {
 
 extern animation_status_t animation_status;
 
+#    ifdef RGBLIGHT_EFFECT_STATS
+typedef struct rgblight_effect_stats_t {
+    uint8_t  mode;      // base mode the stats were collected for
+    uint16_t fps;       // frames rendered during the last second
+    uint16_t flushes;   // frames that changed the LEDs during the last second
+    uint16_t render_ms; // milliseconds spent rendering during the last second
+} rgblight_effect_stats_t;
+
+rgblight_effect_stats_t rgblight_get_effect_stats(void);
+#    endif
+
 void rgblight_effect_breathing(animation_status_t *anim);
 void rgblight_effect_rainbow_mood(animation_status_t *anim);
 void rgblight_effect_rainbow_swirl(animation_status_t *anim);
@@ -0,0 +1,109 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "rgblight.h"
+#include "eeconfig.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+void set_time(uint32_t t);
+}
+
+#include <cstring>
+
+static rgb_t written[RGBLIGHT_LED_COUNT]; // what the driver has been given
+static rgb_t flushed[RGBLIGHT_LED_COUNT]; // what the LEDs are showing
+
+static void capture_init(void) {}
+
+static void capture_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    written[index] = {r, g, b};
+}
+
+static void capture_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+        written[i] = {r, g, b};
+    }
+}
+
+static void capture_flush(void) {
+    memcpy(flushed, written, sizeof(flushed));
+}
+
+extern "C" {
+extern const rgblight_driver_t rgblight_driver;
+const rgblight_driver_t rgblight_driver = {
+    .init          = capture_init,
+    .set_color     = capture_set_color,
+    .set_color_all = capture_set_color_all,
+    .flush         = capture_flush,
+};
+
+void eeconfig_read_rgblight(rgblight_config_t *config) {}
+
+void eeconfig_update_rgblight(const rgblight_config_t *config) {}
+
+bool is_keyboard_master(void) {
+    return true;
+}
+}
+
+static bool leds_match(void) {
+    return memcmp(flushed, written, sizeof(flushed)) == 0;
+}
+
+class RgblightFrames : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        rgblight_init();
+        rgblight_enable_noeeprom();
+        rgblight_sethsv_noeeprom(0, 255, 255);
+        rgblight_mode_noeeprom(RGBLIGHT_MODE_RAINBOW_SWIRL);
+    }
+
+    // Runs the animation for the supplied time, checking that every frame rendered made it out to the LEDs
+    void run(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            rgblight_task();
+            ASSERT_TRUE(leds_match()) << "stale LEDs at " << timer_read32() << "ms";
+        }
+    }
+};
+
+TEST_F(RgblightFrames, FlushesEveryChangedFrame) {
+    run(3000);
+
+    rgblight_effect_stats_t stats = rgblight_get_effect_stats();
+    EXPECT_EQ(stats.mode, RGBLIGHT_MODE_RAINBOW_SWIRL);
+    // The hue moves on every step, so each frame changes the LEDs
+    EXPECT_GT(stats.fps, 5);
+    EXPECT_EQ(stats.flushes, stats.fps);
+}
+
+TEST_F(RgblightFrames, SkipsUnchangedFrames) {
+    // Without saturation every step of the swirl is the same white
+    rgblight_sethsv_noeeprom(0, 0, 128);
+    run(3000);
+
+    rgblight_effect_stats_t stats = rgblight_get_effect_stats();
+    EXPECT_GT(stats.fps, 5);
+    EXPECT_EQ(stats.flushes, 0);
+    EXPECT_EQ(flushed[0].r, flushed[0].b);
+}
+
+TEST_F(RgblightFrames, DirectWritesAreReplacedByTheNextFrame) {
+    rgblight_sethsv_noeeprom(0, 0, 128);
+    run(1000);
+    rgb_t white = flushed[0];
+
+    // The next frame renders the same white as before, but the LED no longer shows it
+    rgblight_setrgb_at(0, 0, 0, 0);
+    EXPECT_EQ(flushed[0].r, 0);
+    run(1000);
+    EXPECT_EQ(flushed[0].r, white.r);
+}
@@ -0,0 +1,21 @@
+rgblight_frames_DEFS := \
+	-DNO_DEBUG \
+	-DRGBLIGHT_ENABLE \
+	-DRGBLIGHT_LED_COUNT=8 \
+	-DRGBLIGHT_EFFECT_RAINBOW_SWIRL \
+	-DRGBLIGHT_EFFECT_STATS
+
+rgblight_frames_CONFIG := $(QUANTUM_PATH)/rgblight/rgblight_post_config.h
+
+rgblight_frames_INC := \
+	$(QUANTUM_PATH)/rgblight
+
+rgblight_frames_SRC := \
+	$(QUANTUM_PATH)/rgblight/tests/rgblight_frames.cpp \
+	$(QUANTUM_PATH)/rgblight/rgblight.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/led_tables.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -0,0 +1,19 @@
+split_transactions_DEFS := \
+	-DNO_DEBUG \
+	-DSPLIT_KEYBOARD \
+	-DMATRIX_ROWS=4 \
+	-DMATRIX_COLS=2 \
+	-DDISABLE_SYNC_TIMER \
+	-DSPLIT_TRANSACTION_IDS_USER=USER_STATE_TO_SLAVE,USER_STATE_TO_MASTER,USER_STATE_SPARE,USER_STREAM
+
+split_transactions_INC := \
+	$(QUANTUM_PATH)/split_common
+
+split_transactions_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/split_transactions.cpp \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(PLATFORM_PATH)/synchronization_util.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -0,0 +1,266 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "transactions.h"
+#include "transport.h"
+#include "transaction_id_define.h"
+#include "timer.h"
+#include "crc.h"
+
+void advance_time(uint32_t ms);
+void set_time(uint32_t t);
+}
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+static bool     rpc_fails = false;
+static uint32_t rpc_calls[NUM_TOTAL_TRANSACTIONS];
+static uint32_t transactions[NUM_TOTAL_TRANSACTIONS];
+
+// Both halves share one process, so each shared state's data is swapped for the slave's copy while the slave runs
+static std::vector<std::pair<split_shared_state_t *, void *>> slave_copies;
+
+static void swap_to_slave_copies(void) {
+    for (auto &copy : slave_copies) {
+        std::swap(copy.first->data, copy.second);
+    }
+}
+
+extern "C" {
+bool is_transport_connected(void) {
+    return true;
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+// Loops each transaction straight back through the slave side, with both halves sharing the same split_shmem
+bool soft_serial_transaction(int sstd_index) {
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+    transactions[sstd_index]++;
+    if (sstd_index == EXECUTE_RPC) {
+        if (rpc_fails) {
+            return false;
+        }
+        rpc_calls[split_shmem->rpc_info.payload.transaction_id]++;
+    }
+    if (trans->slave_callback) {
+        swap_to_slave_copies();
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        swap_to_slave_copies();
+    }
+    return true;
+}
+}
+
+struct test_state_t {
+    uint8_t  mode;
+    uint16_t value;
+};
+
+static test_state_t to_slave_master, to_slave_slave;
+static test_state_t to_master_master, to_master_slave;
+
+static split_shared_state_t to_slave = {
+    .transaction_id = USER_STATE_TO_SLAVE,
+    .direction      = SPLIT_SHARED_STATE_MASTER_TO_SLAVE,
+    .data           = &to_slave_master,
+    .size           = sizeof(test_state_t),
+    .force_sync_ms  = 0,
+};
+
+static split_shared_state_t to_master = {
+    .transaction_id = USER_STATE_TO_MASTER,
+    .direction      = SPLIT_SHARED_STATE_SLAVE_TO_MASTER,
+    .data           = &to_master_master,
+    .size           = sizeof(test_state_t),
+    .force_sync_ms  = 0,
+};
+
+// What the slave has received over the stream, and the chunks it arrived in
+static std::vector<uint8_t>  streamed;
+static std::vector<uint16_t> stream_offsets;
+
+static void stream_received(uint16_t offset, uint8_t length, const void *data, uint16_t total_length) {
+    streamed.resize(total_length);
+    ASSERT_LE(offset + length, total_length);
+    memcpy(&streamed[offset], data, length);
+    stream_offsets.push_back(offset);
+}
+
+static void stream_fill(uint16_t offset, uint8_t length, void *buffer) {
+    for (uint8_t i = 0; i < length; i++) {
+        ((uint8_t *)buffer)[i] = (uint8_t)(offset + i) ^ 0x5A;
+    }
+}
+
+class SplitTransactions : public ::testing::Test {
+   protected:
+    matrix_row_t master_matrix[MATRIX_ROWS / 2] = {0};
+    matrix_row_t slave_matrix[MATRIX_ROWS / 2]  = {0};
+
+    static void SetUpTestSuite() {
+        ASSERT_TRUE(transaction_register_shared_state(&to_slave));
+        ASSERT_TRUE(transaction_register_shared_state(&to_master));
+        slave_copies.push_back({&to_slave, &to_slave_slave});
+        slave_copies.push_back({&to_master, &to_master_slave});
+        ASSERT_TRUE(transaction_register_stream(USER_STREAM, stream_received));
+    }
+
+    void SetUp() override {
+        set_time(0);
+        rpc_fails = false;
+        streamed.clear();
+        stream_offsets.clear();
+        transactions_slave(master_matrix, slave_matrix);
+        // Settle any outstanding syncs from previous tests
+        ASSERT_TRUE(transactions_master(master_matrix, slave_matrix));
+        memset(rpc_calls, 0, sizeof(rpc_calls));
+        memset(transactions, 0, sizeof(transactions));
+    }
+
+    bool sync(void) {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+};
+
+TEST_F(SplitTransactions, RejectsInvalidSharedStates) {
+    static uint8_t       buffer[RPC_M2S_BUFFER_SIZE + 1];
+    split_shared_state_t duplicate = {.transaction_id = USER_STATE_TO_SLAVE, .direction = SPLIT_SHARED_STATE_MASTER_TO_SLAVE, .data = buffer, .size = 1};
+    EXPECT_FALSE(transaction_register_shared_state(&duplicate));
+
+    split_shared_state_t too_large = {.transaction_id = USER_STATE_SPARE, .direction = SPLIT_SHARED_STATE_MASTER_TO_SLAVE, .data = buffer, .size = RPC_M2S_BUFFER_SIZE + 1};
+    EXPECT_FALSE(transaction_register_shared_state(&too_large));
+
+    split_shared_state_t core = {.transaction_id = GET_SLAVE_MATRIX_DATA, .direction = SPLIT_SHARED_STATE_MASTER_TO_SLAVE, .data = buffer, .size = 1};
+    EXPECT_FALSE(transaction_register_shared_state(&core));
+}
+
+TEST_F(SplitTransactions, SendsMasterStateOnlyWhenChanged) {
+    to_slave_master = {3, 1234};
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(to_slave_slave.mode, 3);
+    EXPECT_EQ(to_slave_slave.value, 1234);
+    EXPECT_EQ(rpc_calls[USER_STATE_TO_SLAVE], 1);
+
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(rpc_calls[USER_STATE_TO_SLAVE], 1);
+
+    // Marking the state dirty sends it even though its contents are unchanged
+    transaction_shared_state_mark_dirty(&to_slave);
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(rpc_calls[USER_STATE_TO_SLAVE], 2);
+}
+
+TEST_F(SplitTransactions, SendsMasterStateWithAnUnchangedChecksum) {
+    to_slave_master = {1, 0};
+    ASSERT_TRUE(sync());
+    uint8_t checksum = crc8(&to_slave_master, sizeof(to_slave_master));
+
+    // Find a different state that an 8-bit checksum can't tell apart
+    do {
+        to_slave_master.value++;
+    } while (crc8(&to_slave_master, sizeof(to_slave_master)) != checksum);
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(to_slave_slave.value, to_slave_master.value);
+    EXPECT_EQ(rpc_calls[USER_STATE_TO_SLAVE], 2);
+}
+
+TEST_F(SplitTransactions, PullsSlaveStateOnlyWhenChanged) {
+    // Each pass asks for the slave's checksum, and only fetches the data when it differs
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(rpc_calls[USER_STATE_TO_MASTER], 1);
+
+    to_master_slave = {7, 4321};
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(to_master_master.mode, 7);
+    EXPECT_EQ(to_master_master.value, 4321);
+    EXPECT_EQ(rpc_calls[USER_STATE_TO_MASTER], 3);
+
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(rpc_calls[USER_STATE_TO_MASTER], 4);
+}
+
+TEST_F(SplitTransactions, ForcesPeriodicResyncs) {
+    to_slave.force_sync_ms = 100;
+    advance_time(50);
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(rpc_calls[USER_STATE_TO_SLAVE], 0);
+
+    advance_time(50);
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(rpc_calls[USER_STATE_TO_SLAVE], 1);
+
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(rpc_calls[USER_STATE_TO_SLAVE], 1);
+    to_slave.force_sync_ms = 0;
+}
+
+TEST_F(SplitTransactions, RetriesFailedSyncs) {
+    to_slave_master = {9, 99};
+    rpc_fails       = true;
+    EXPECT_FALSE(sync());
+    EXPECT_NE(to_slave_slave.mode, 9);
+
+    rpc_fails = false;
+    ASSERT_TRUE(sync());
+    EXPECT_EQ(to_slave_slave.mode, 9);
+    EXPECT_EQ(to_slave_slave.value, 99);
+}
+
+// Each chunk carries a 4-byte offset and length header within the RPC buffer
+#define STREAM_CHUNK_SIZE (RPC_M2S_BUFFER_SIZE - 4)
+
+TEST_F(SplitTransactions, StreamsPayloadsInChunks) {
+    std::vector<uint8_t> payload(STREAM_CHUNK_SIZE * 3 + 5);
+    for (size_t i = 0; i < payload.size(); i++) {
+        payload[i] = (uint8_t)(i * 7);
+    }
+
+    ASSERT_TRUE(transaction_rpc_send_stream(USER_STREAM, payload.size(), payload.data()));
+    EXPECT_EQ(streamed, payload);
+    EXPECT_EQ(stream_offsets, (std::vector<uint16_t>{0, STREAM_CHUNK_SIZE, STREAM_CHUNK_SIZE * 2, STREAM_CHUNK_SIZE * 3}));
+
+    // The RPC info block is only resent when the chunk size changes, for the shorter last chunk
+    EXPECT_EQ(rpc_calls[USER_STREAM], 4);
+    EXPECT_EQ(transactions[PUT_RPC_REQ_DATA], 4);
+    EXPECT_EQ(transactions[PUT_RPC_INFO], 2);
+    EXPECT_EQ(transactions[GET_RPC_RESP_DATA], 0);
+}
+
+TEST_F(SplitTransactions, StreamsFromAFillCallback) {
+    ASSERT_TRUE(transaction_rpc_stream(USER_STREAM, STREAM_CHUNK_SIZE * 2, stream_fill, NULL));
+    ASSERT_EQ(streamed.size(), STREAM_CHUNK_SIZE * 2);
+    for (size_t i = 0; i < streamed.size(); i++) {
+        EXPECT_EQ(streamed[i], (uint8_t)(i ^ 0x5A)) << "at " << i;
+    }
+    EXPECT_EQ(transactions[PUT_RPC_INFO], 1);
+}
+
+TEST_F(SplitTransactions, RejectsInvalidStreams) {
+    EXPECT_FALSE(transaction_register_stream(USER_STREAM, stream_received));
+    EXPECT_FALSE(transaction_register_stream(GET_RPC_RESP_DATA, stream_received));
+}
+
+TEST_F(SplitTransactions, StreamsTheLongestPayloads) {
+    // The offset of the last chunk would wrap a 16-bit counter
+    ASSERT_TRUE(transaction_rpc_stream(USER_STREAM, UINT16_MAX, stream_fill, NULL));
+    ASSERT_EQ(streamed.size(), UINT16_MAX);
+    EXPECT_EQ(stream_offsets.size(), (UINT16_MAX + STREAM_CHUNK_SIZE - 1) / STREAM_CHUNK_SIZE);
+    EXPECT_EQ(stream_offsets.back(), UINT16_MAX - UINT16_MAX % STREAM_CHUNK_SIZE);
+    EXPECT_EQ(streamed.back(), (uint8_t)((UINT16_MAX - 1) ^ 0x5A));
+}
+
+TEST_F(SplitTransactions, StopsStreamingOnFailure) {
+    std::vector<uint8_t> payload(STREAM_CHUNK_SIZE * 2);
+    rpc_fails = true;
+    EXPECT_FALSE(transaction_rpc_send_stream(USER_STREAM, payload.size(), payload.data()));
+    EXPECT_TRUE(stream_offsets.empty());
+    EXPECT_EQ(transactions[EXECUTE_RPC], 1);
+}
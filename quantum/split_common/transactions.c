@@ -914,6 +914,105 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Shared state
+
+#if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+
+#    ifndef SPLIT_SHARED_STATE_MAX_ENTRIES
+#        define SPLIT_SHARED_STATE_MAX_ENTRIES 4
+#    endif // SPLIT_SHARED_STATE_MAX_ENTRIES
+
+enum {
+    SHARED_STATE_REQUEST_CHECKSUM,
+    SHARED_STATE_REQUEST_DATA,
+};
+
+static split_shared_state_t *shared_states[SPLIT_SHARED_STATE_MAX_ENTRIES];
+static uint8_t               shared_state_count = 0;
+// Last copy of each master-to-slave state sent, like the built-in syncs compare against split_shmem
+static uint8_t shared_state_sent[SPLIT_SHARED_STATE_MAX_ENTRIES][RPC_M2S_BUFFER_SIZE];
+
+static split_shared_state_t *shared_state_lookup(int8_t transaction_id) {
+    for (uint8_t i = 0; i < shared_state_count; ++i) {
+        if (shared_states[i]->transaction_id == transaction_id) {
+            return shared_states[i];
+        }
+    }
+    return NULL;
+}
+
+static void shared_state_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_shared_state_t *state = shared_state_lookup(split_shmem->rpc_info.payload.transaction_id);
+    if (!state) {
+        return;
+    }
+
+    if (state->direction == SPLIT_SHARED_STATE_MASTER_TO_SLAVE) {
+        if (initiator2target_buffer_size == state->size) {
+            memcpy(state->data, initiator2target_buffer, state->size);
+        }
+    } else if (initiator2target_buffer_size == 1) {
+        uint8_t request = *(const uint8_t *)initiator2target_buffer;
+        if (request == SHARED_STATE_REQUEST_CHECKSUM && target2initiator_buffer_size == 1) {
+            *(uint8_t *)target2initiator_buffer = crc8(state->data, state->size);
+        } else if (request == SHARED_STATE_REQUEST_DATA && target2initiator_buffer_size == state->size) {
+            memcpy(target2initiator_buffer, state->data, state->size);
+        }
+    }
+}
+
+static bool shared_state_sync_master(uint8_t index) {
+    split_shared_state_t *state  = shared_states[index];
+    bool                  forced = state->force_sync_ms != 0 && timer_elapsed32(state->last_update) >= state->force_sync_ms;
+
+    if (state->direction == SPLIT_SHARED_STATE_MASTER_TO_SLAVE) {
+        if (!forced && !state->dirty && memcmp(state->data, shared_state_sent[index], state->size) == 0) {
+            return true;
+        }
+        if (!transaction_rpc_send(state->transaction_id, state->size, state->data)) {
+            return false;
+        }
+        memcpy(shared_state_sent[index], state->data, state->size);
+    } else {
+        // Same scheme as the built-in slave-to-master syncs: only pull the data across if the remote checksum differs
+        uint8_t request       = SHARED_STATE_REQUEST_CHECKSUM;
+        uint8_t curr_checksum = 0;
+        if (!transaction_rpc_exec(state->transaction_id, sizeof(request), &request, sizeof(curr_checksum), &curr_checksum)) {
+            return false;
+        }
+        if (!forced && !state->dirty && curr_checksum == state->checksum) {
+            return true;
+        }
+        request = SHARED_STATE_REQUEST_DATA;
+        if (!transaction_rpc_exec(state->transaction_id, sizeof(request), &request, state->size, state->data)) {
+            return false;
+        }
+        state->checksum = crc8(state->data, state->size);
+    }
+
+    state->dirty       = false;
+    state->last_update = timer_read32();
+    return true;
+}
+
+static bool shared_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    bool okay = true;
+    for (uint8_t i = 0; i < shared_state_count; ++i) {
+        // Failed entries keep their stale copy or checksum, so they get retried on the next pass
+        okay &= shared_state_sync_master(i);
+    }
+    return okay;
+}
+
+#    define TRANSACTIONS_SHARED_STATE_MASTER() TRANSACTION_HANDLER_MASTER(shared_state)
+
+#else // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+
+#    define TRANSACTIONS_SHARED_STATE_MASTER()
+
+#endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -974,6 +1073,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_SHARED_STATE_MASTER();
     return true;
 }
 
@@ -1044,12 +1144,130 @@ bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer
     if (!transport_write(EXECUTE_RPC, &transaction_id, sizeof(transaction_id))) {
         return false;
     }
-    if (!transport_read(GET_RPC_RESP_DATA, target2initiator_buffer, target2initiator_buffer_size)) {
+    // Skip the round-trip entirely for send-only RPCs
+    if (target2initiator_buffer_size > 0 && !transport_read(GET_RPC_RESP_DATA, target2initiator_buffer, target2initiator_buffer_size)) {
         return false;
     }
     return true;
 }
 
+#    ifndef SPLIT_RPC_STREAM_MAX_ENTRIES
+#        define SPLIT_RPC_STREAM_MAX_ENTRIES 2
+#    endif // SPLIT_RPC_STREAM_MAX_ENTRIES
+
+typedef struct _rpc_stream_header_t {
+    uint16_t offset;
+    uint16_t total_length;
+} rpc_stream_header_t;
+
+#    define RPC_STREAM_CHUNK_SIZE (RPC_M2S_BUFFER_SIZE - sizeof(rpc_stream_header_t))
+STATIC_ASSERT(RPC_M2S_BUFFER_SIZE > sizeof(rpc_stream_header_t), "RPC_M2S_BUFFER_SIZE too small for streaming");
+
+static struct {
+    int8_t                  transaction_id;
+    slave_stream_callback_t callback;
+} rpc_streams[SPLIT_RPC_STREAM_MAX_ENTRIES];
+static uint8_t rpc_stream_count = 0;
+
+static void slave_rpc_stream_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    if (initiator2target_buffer_size < sizeof(rpc_stream_header_t)) {
+        return;
+    }
+
+    int8_t transaction_id = split_shmem->rpc_info.payload.transaction_id;
+    for (uint8_t i = 0; i < rpc_stream_count; ++i) {
+        if (rpc_streams[i].transaction_id == transaction_id) {
+            // The header may not be suitably aligned within the shared memory, so copy it out
+            rpc_stream_header_t header;
+            memcpy(&header, initiator2target_buffer, sizeof(header));
+            rpc_streams[i].callback(header.offset, initiator2target_buffer_size - sizeof(rpc_stream_header_t), ((const uint8_t *)initiator2target_buffer) + sizeof(rpc_stream_header_t), header.total_length);
+            return;
+        }
+    }
+}
+
+bool transaction_register_stream(int8_t transaction_id, slave_stream_callback_t callback) {
+    // Prevent streaming over QMK core sync data
+    if (transaction_id <= GET_RPC_RESP_DATA) return false;
+    if (rpc_stream_count >= SPLIT_RPC_STREAM_MAX_ENTRIES) return false;
+    for (uint8_t i = 0; i < rpc_stream_count; ++i) {
+        if (rpc_streams[i].transaction_id == transaction_id) return false;
+    }
+
+    rpc_streams[rpc_stream_count].transaction_id = transaction_id;
+    rpc_streams[rpc_stream_count].callback       = callback;
+    rpc_stream_count++;
+
+    transaction_register_rpc(transaction_id, slave_rpc_stream_callback);
+    return true;
+}
+
+bool transaction_rpc_stream(int8_t transaction_id, uint16_t total_length, stream_fill_callback_t fill, const void *data) {
+    // Prevent transaction attempts while transport is disconnected
+    if (!is_transport_connected()) {
+        return false;
+    }
+    // Prevent invoking RPC on QMK core sync data
+    if (transaction_id <= GET_RPC_RESP_DATA) return false;
+
+    uint8_t *payload = split_shmem->rpc_m2s_buffer + sizeof(rpc_stream_header_t);
+    uint8_t  m2s_len = 0;
+
+    // A 16-bit offset would wrap on the last chunk of streams close to UINT16_MAX long
+    for (uint32_t offset = 0; offset < total_length; offset += RPC_STREAM_CHUNK_SIZE) {
+        uint8_t chunk_len = (total_length - offset) < RPC_STREAM_CHUNK_SIZE ? (total_length - offset) : RPC_STREAM_CHUNK_SIZE;
+
+        // Only resend the metadata block when the chunk length changes -- for all but the last chunk this happens once per stream
+        if (m2s_len != chunk_len + sizeof(rpc_stream_header_t)) {
+            m2s_len              = chunk_len + sizeof(rpc_stream_header_t);
+            rpc_sync_info_t info = {.payload = {.transaction_id = transaction_id, .m2s_length = m2s_len, .s2m_length = 0}};
+            info.checksum        = crc8(&info.payload, sizeof(info.payload));
+
+            split_transaction_table[PUT_RPC_REQ_DATA].initiator2target_buffer_size  = m2s_len;
+            split_transaction_table[GET_RPC_RESP_DATA].target2initiator_buffer_size = 0;
+            if (!transport_write(PUT_RPC_INFO, &info, sizeof(info))) {
+                return false;
+            }
+        }
+
+        // Build the chunk directly inside the transport buffer, the transport skips the copy when handed its own buffer
+        rpc_stream_header_t header = {.offset = offset, .total_length = total_length};
+        memcpy(split_shmem->rpc_m2s_buffer, &header, sizeof(header));
+        if (fill) {
+            fill(offset, chunk_len, payload);
+        } else {
+            memcpy(payload, ((const uint8_t *)data) + offset, chunk_len);
+        }
+
+        if (!transport_write(PUT_RPC_REQ_DATA, split_shmem->rpc_m2s_buffer, m2s_len)) {
+            return false;
+        }
+        if (!transport_write(EXECUTE_RPC, &transaction_id, sizeof(transaction_id))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool transaction_register_shared_state(split_shared_state_t *state) {
+    // Prevent replicating over QMK core sync data
+    if (state->transaction_id <= GET_RPC_RESP_DATA) return false;
+    if (shared_state_count >= SPLIT_SHARED_STATE_MAX_ENTRIES || shared_state_lookup(state->transaction_id)) return false;
+    if (state->direction == SPLIT_SHARED_STATE_MASTER_TO_SLAVE && state->size > RPC_M2S_BUFFER_SIZE) return false;
+    if (state->direction == SPLIT_SHARED_STATE_SLAVE_TO_MASTER && state->size > RPC_S2M_BUFFER_SIZE) return false;
+
+    // Force an initial sync once the transport comes up
+    state->dirty = true;
+
+    transaction_register_rpc(state->transaction_id, shared_state_slave_callback);
+    shared_states[shared_state_count++] = state;
+    return true;
+}
+
+void transaction_shared_state_mark_dirty(split_shared_state_t *state) {
+    state->dirty = true;
+}
+
 void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
     // The RPC info block contains the intended transaction ID, as well as the sizes for both inbound and outbound data.
     // Ignore the args -- the `split_shmem` already has the info, we just need to act upon it.
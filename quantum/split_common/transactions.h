@@ -49,5 +49,35 @@ void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
 
+typedef void (*slave_stream_callback_t)(uint16_t offset, uint8_t length, const void *data, uint16_t total_length);
+typedef void (*stream_fill_callback_t)(uint16_t offset, uint8_t length, void *buffer);
+
+bool transaction_register_stream(int8_t transaction_id, slave_stream_callback_t callback);
+
+bool transaction_rpc_stream(int8_t transaction_id, uint16_t total_length, stream_fill_callback_t fill, const void *data);
+
+#define transaction_rpc_send_stream(transaction_id, total_length, data) transaction_rpc_stream(transaction_id, total_length, NULL, data)
+
+typedef enum split_shared_state_direction_t {
+    SPLIT_SHARED_STATE_MASTER_TO_SLAVE,
+    SPLIT_SHARED_STATE_SLAVE_TO_MASTER,
+} split_shared_state_direction_t;
+
+// Replicated state descriptor, registered identically on both halves
+typedef struct split_shared_state_t {
+    int8_t                         transaction_id;
+    split_shared_state_direction_t direction;
+    void                          *data;
+    uint8_t                        size;
+    uint16_t                       force_sync_ms; // 0 = only sync when the data changes
+    // Internal bookkeeping
+    bool     dirty;
+    uint8_t  checksum; // slave-to-master only
+    uint32_t last_update;
+} split_shared_state_t;
+
+bool transaction_register_shared_state(split_shared_state_t *state);
+void transaction_shared_state_mark_dirty(split_shared_state_t *state);
+
 #define transaction_rpc_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
 #define transaction_rpc_recv(transaction_id, target2initiator_buffer_size, target2initiator_buffer) transaction_rpc_exec(transaction_id, 0, NULL, target2initiator_buffer_size, target2initiator_buffer)
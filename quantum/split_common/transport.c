@@ -65,7 +65,9 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
-        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        if (initiator2target_buf != split_trans_initiator2target_buffer(trans)) {
+            memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        }
         if ((status = i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), len, SLAVE_I2C_TIMEOUT)) < 0) {
             return false;
         }
@@ -105,7 +107,9 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
-        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        if (initiator2target_buf != split_trans_initiator2target_buffer(trans)) {
+            memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        }
     }
 
     if (!soft_serial_transaction(id)) {
@@ -0,0 +1,101 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+}
+
+class ColorBatch : public ::testing::Test {
+   protected:
+    // Every saturation for the given hue and value
+    static std::vector<hsv_t> row(uint8_t h, uint8_t v) {
+        std::vector<hsv_t> hsv;
+        hsv.reserve(256);
+        for (int s = 0; s < 256; s++) {
+            hsv.push_back({h, (uint8_t)s, v});
+        }
+        return hsv;
+    }
+};
+
+TEST_F(ColorBatch, MatchesScalarConversion) {
+    std::vector<rgb_t> rgb(256);
+    for (int v = 0; v < 256; v++) {
+        for (int h = 0; h < 256; h++) {
+            std::vector<hsv_t> hsv = row(h, v);
+            hsv_to_rgb_batch(hsv.data(), rgb.data(), hsv.size());
+            for (size_t i = 0; i < hsv.size(); i++) {
+                rgb_t expected = hsv_to_rgb(hsv[i]);
+                ASSERT_EQ(expected.r, rgb[i].r) << "h=" << h << " s=" << i << " v=" << v;
+                ASSERT_EQ(expected.g, rgb[i].g) << "h=" << h << " s=" << i << " v=" << v;
+                ASSERT_EQ(expected.b, rgb[i].b) << "h=" << h << " s=" << i << " v=" << v;
+            }
+        }
+    }
+}
+
+TEST_F(ColorBatch, MatchesScalarConversionWithoutCie) {
+    std::vector<rgb_t> rgb(256);
+    for (int v = 0; v < 256; v++) {
+        for (int h = 0; h < 256; h++) {
+            std::vector<hsv_t> hsv = row(h, v);
+            hsv_to_rgb_nocie_batch(hsv.data(), rgb.data(), hsv.size());
+            for (size_t i = 0; i < hsv.size(); i++) {
+                rgb_t expected = hsv_to_rgb_nocie(hsv[i]);
+                ASSERT_EQ(expected.r, rgb[i].r) << "h=" << h << " s=" << i << " v=" << v;
+                ASSERT_EQ(expected.g, rgb[i].g) << "h=" << h << " s=" << i << " v=" << v;
+                ASSERT_EQ(expected.b, rgb[i].b) << "h=" << h << " s=" << i << " v=" << v;
+            }
+        }
+    }
+}
+
+TEST_F(ColorBatch, HandlesEmptyBatch) {
+    hsv_t hsv = {0, 255, 255};
+    rgb_t rgb = {1, 2, 3};
+    hsv_to_rgb_batch(&hsv, &rgb, 0);
+    EXPECT_EQ(rgb.r, 1);
+    EXPECT_EQ(rgb.g, 2);
+    EXPECT_EQ(rgb.b, 3);
+}
+
+// Run with --gtest_also_run_disabled_tests to compare throughput
+TEST_F(ColorBatch, DISABLED_Benchmark) {
+    using clock = std::chrono::steady_clock;
+
+    std::vector<hsv_t> hsv;
+    for (int h = 0; h < 256; h += 16) {
+        std::vector<hsv_t> hues = row(h, 200);
+        hsv.insert(hsv.end(), hues.begin(), hues.end());
+    }
+    std::vector<rgb_t> rgb(hsv.size());
+    const int          rounds = 10000;
+    uint32_t           sink   = 0;
+
+    auto start = clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < hsv.size(); i++) {
+            rgb[i] = hsv_to_rgb(hsv[i]);
+        }
+        sink += rgb[r % rgb.size()].r;
+    }
+    auto scalar = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    start = clock::now();
+    for (int r = 0; r < rounds; r++) {
+        hsv_to_rgb_batch(hsv.data(), rgb.data(), hsv.size());
+        sink += rgb[r % rgb.size()].r;
+    }
+    auto batch = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    double conversions = (double)rounds * hsv.size();
+    std::cout << "scalar: " << scalar / conversions << " ns/conversion" << std::endl;
+    std::cout << "batch:  " << batch / conversions << " ns/conversion" << std::endl;
+    EXPECT_NE(sink, 0xFFFFFFFF);
+}